@@ -28,8 +28,18 @@
 extern "C" {
 #endif
 
+#include <stddef.h>
 #include <stdint.h>
 
+/**
+ * @def TINY_TIME_NO_DIV64
+ * @brief Compile time profile for targets without a 64 bit divider.
+ *
+ * Define TINY_TIME_NO_DIV64 when compiling the library to do all conversions
+ * with 32 bit multiply and shift operations. No hardware or software 64 bit
+ * division (e.g. __aeabi_uldivmod) is used in this profile.
+ */
+
 /**
  * @enum TINY_MONTHS
  * @brief Enumeration representing the months of the year.
@@ -71,6 +81,36 @@ typedef enum {
   TINY_MAX_WEAKDAYS
 } TINY_WEAK_DAYS;
 
+/**
+ * @enum TINY_SIMD_LEVELS
+ * @brief Enumeration representing the SIMD kernels of the batch conversions.
+ *
+ * The kernels are selected at runtime by the CPU features. The x86 kernels
+ * are only compiled with GCC compatible compilers on x86-64 and can be
+ * disabled with TINY_TIME_NO_SIMD.
+ */
+typedef enum {
+  TINY_SIMD_NONE = 0, ///< Scalar conversion
+  TINY_SIMD_SSE41,    ///< SSE4.1 kernels with 4 lanes
+  TINY_SIMD_AVX2,     ///< AVX2 kernels with 8 lanes
+  TINY_SIMD_AVX512,   ///< AVX-512 kernels with 16 lanes
+  TINY_MAX_SIMD_LEVELS
+} TINY_SIMD_LEVELS;
+
+/**
+ * @enum TINY_EPOCH_UNITS
+ * @brief Enumeration representing the units of epoch timestamp strings.
+ *
+ */
+typedef enum {
+  TINY_EPOCH_AUTO = 0, ///< Detected by the number of digits
+  TINY_EPOCH_SEC,      ///< Seconds since the unix epoch
+  TINY_EPOCH_MILLI,    ///< Milliseconds since the unix epoch
+  TINY_EPOCH_MICRO,    ///< Microseconds since the unix epoch
+  TINY_EPOCH_NANO,     ///< Nanoseconds since the unix epoch
+  TINY_MAX_EPOCH_UNITS
+} TINY_EPOCH_UNITS;
+
 /**
  * @struct tinyTimeType
  * @brief Structure representing a compact date and time format.
@@ -94,12 +134,41 @@ typedef struct {
   uint16_t yearDay; ///< Current year day
 } tinyTimeType;
 
+/**
+ * @struct tinyTimeColumnsType
+ * @brief Structure referencing separate arrays of the time and date fields.
+ *
+ * Structure of arrays form of tinyTimeType for column wise conversions. Every
+ * array holds the same field of all elements with the ranges of tinyTimeType.
+ */
+typedef struct {
+  const uint8_t *sec;      ///< Array of seconds after minute
+  const uint8_t *min;      ///< Array of minutes after hour
+  const uint8_t *hour;     ///< Array of hours since midnight
+  const uint8_t *monthDay; ///< Array of days of the month starting at 1
+  const uint8_t *month;    ///< Array of months ranged from 1 - 12
+  const uint16_t *year;    ///< Array of years since year 0
+} tinyTimeColumnsType;
+
 /**
  * @brief Tiny Unix Time Type
  *
  */
 typedef uint64_t tinyUnixType;
 
+/**
+ * @struct tinyConverterType
+ * @brief Context of the incremental unix time conversion.
+ *
+ * Caches the date of the last converted day, so following unix times of the
+ * same or the next day only need the day time to be calculated.
+ * Initialize it with tiny_initConverter.
+ */
+typedef struct {
+  tinyUnixType dayStart; ///< Unix time of the cached day at midnight
+  tinyTimeType day;      ///< Date of the cached day
+} tinyConverterType;
+
 #define TINY_SEC_MAX ((uint8_t)59)    ///< Max second value
 #define TINY_MINUTE_MAX ((uint8_t)59) ///< Max minute value
 #define TINY_HOUR_MAX ((uint8_t)23)   ///< Max hour value
@@ -111,6 +180,139 @@ typedef uint64_t tinyUnixType;
 #define TINY_ONE_DAY_IN_SEC ((uint32_t)86400) ///< One day in seconds
 #define TINY_ONE_YEAR_IN_DAYS ((uint16_t)365) ///< One basic year in days
 
+#define TINY_FORMAT_LENGTH (24U) ///< Length of a formatted time until 9999
+#define TINY_FORMAT_BUFFER_SIZE                                                \
+  (32U) ///< Buffer size for the formatted string of any tinyTimeType
+#define TINY_SYSLOG_LENGTH (15U) ///< Length of a RFC 3164 "Mmm dd hh:mm:ss"
+
+/**
+ * @struct tinyFormatCacheType
+ * @brief Cache of the last formatted unix time.
+ *
+ * Holds the tiny_getFormat string of the last unix time. Unix times of the
+ * same day only patch the time digits of the string. The cache has no shared
+ * state, use one cache per thread (e.g. a _Thread_local variable) to format
+ * without locks. Initialize it with tiny_initFormatCache.
+ */
+typedef struct {
+  tinyUnixType unixTime;                ///< Unix time of the cached string
+  tinyUnixType dayStart;                ///< Unix time of the day at midnight
+  uint8_t length;                       ///< Length of the cached string
+  char format[TINY_FORMAT_BUFFER_SIZE]; ///< The cached string
+} tinyFormatCacheType;
+
+/**
+ * @struct tinyParseCacheType
+ * @brief Cache of the date of the last parsed string.
+ *
+ * Holds the date characters of the last parsed string and the days of the
+ * date since the unix epoch. Strings with the same date characters only parse
+ * the time of the day. The cache has no shared state, use one cache per
+ * stream and thread. Initialize it with tiny_initParseCache.
+ */
+typedef struct {
+  uint64_t prefix[2]; ///< Date characters of the last parsed string
+  uint32_t days;      ///< Days since the unix epoch of the cached date
+  uint8_t layout;     ///< Layout of the cached date, 0 if empty
+} tinyParseCacheType;
+
+#define TINY_STREAM_WINDOW                                                     \
+  (48U) ///< Characters of a line start that hold the timestamp of a stream
+
+/**
+ * @struct tinyStreamParserType
+ * @brief State of a push parser of timestamped lines.
+ *
+ * Holds the start of a line split by a chunk boundary and the date cache of
+ * the stream. Use one parser per stream. Initialize it with
+ * tiny_initStreamParser.
+ */
+typedef struct {
+  tinyParseCacheType cache;       ///< Date cache of the stream
+  uint8_t isSkipping;             ///< 1 while skipping the rest of a line
+  uint8_t carryLength;            ///< Characters of a split line start
+  char carry[TINY_STREAM_WINDOW]; ///< The split line start
+} tinyStreamParserType;
+
+#define TINY_RFC3339_BUFFER_SIZE                                               \
+  (36U) ///< Buffer size for any RFC 3339 string with fraction and offset
+#define TINY_RFC3339_MAX_FRACTION                                              \
+  (9U) ///< Max fraction digits of a RFC 3339 string, nanoseconds
+#define TINY_RFC3339_MAX_OFFSET                                                \
+  ((int16_t)1439) ///< Max UTC offset in minutes of a RFC 3339 string, 23:59
+
+#define TINY_HTTP_DATE_LENGTH (29U) ///< Length of an IMF-fixdate string
+#define TINY_HTTP_DATE_BUFFER_SIZE                                             \
+  (32U) ///< Buffer size for an IMF-fixdate string
+
+#ifdef __GNUC__
+/**
+ * @struct tinyHttpDateType
+ * @brief Shared IMF-fixdate string of the current second.
+ *
+ * The string is refreshed by the first reader of a new second and read by
+ * all other threads without locks. The fields are only accessed with the
+ * atomic builtins of GCC compatible compilers. Initialize it with
+ * tiny_initHttpDate.
+ */
+typedef struct {
+  uint32_t sequence;    ///< Odd while a new second is written
+  uint32_t unixTime[2]; ///< Low and high word of the published second
+  uint32_t words[TINY_HTTP_DATE_BUFFER_SIZE / 4U]; ///< The published string
+} tinyHttpDateType;
+#endif
+
+#define TINY_FORMAT_PROGRAM_OPS (32U) ///< Max operations of a format program
+#define TINY_FORMAT_PROGRAM_LITERALS                                           \
+  (64U) ///< Max literal characters of a format program
+#define TINY_FORMAT_PROGRAM_LENGTH                                             \
+  (128U) ///< Max formatted length of a format program
+
+/**
+ * @struct tinyFormatProgramType
+ * @brief Precompiled strftime like format pattern.
+ *
+ * Holds the operations of a pattern compiled with tiny_formatCompile, so
+ * tiny_formatRun does not parse the pattern again. Adjacent literal
+ * characters are merged into a single operation.
+ */
+typedef struct {
+  uint8_t opCount;                      ///< Number of operations
+  uint8_t literalCount;                 ///< Number of literal characters
+  uint8_t maxLength;                    ///< Longest formatted length
+  uint8_t fixedLength; ///< Length for unix times until 9999, 0 if variable
+  uint8_t ops[TINY_FORMAT_PROGRAM_OPS]; ///< Operation codes
+  uint8_t args[TINY_FORMAT_PROGRAM_OPS]; ///< Literal lengths of operations
+  char literals[TINY_FORMAT_PROGRAM_LITERALS]; ///< Literal characters
+} tinyFormatProgramType;
+
+#define TINY_PARSE_PROGRAM_OPS (32U) ///< Max operations of a parse program
+#define TINY_PARSE_PROGRAM_LITERALS                                            \
+  (64U) ///< Max literal characters of a parse program
+#define TINY_PARSE_PROGRAM_LENGTH                                              \
+  (128U) ///< Max length of the fixed width parts of a parse program
+
+/**
+ * @struct tinyParseProgramType
+ * @brief Precompiled strptime like parse pattern.
+ *
+ * Holds the operations of a pattern compiled with tiny_parseCompile, so
+ * tiny_parseRun does not interpret the pattern again. Every field is read at
+ * a fixed offset from the string start, or from the end of the last full
+ * name, which is the only field with a variable width.
+ */
+typedef struct {
+  uint8_t opCount;      ///< Number of operations
+  uint8_t literalCount; ///< Number of literal characters
+  uint8_t minLength;    ///< Length of the part before the first full name
+  uint8_t tailLength;   ///< Length of the part after the last full name
+  uint8_t ops[TINY_PARSE_PROGRAM_OPS];     ///< Operation codes
+  uint8_t offsets[TINY_PARSE_PROGRAM_OPS]; ///< Offsets of the fields
+  uint8_t args[TINY_PARSE_PROGRAM_OPS]; ///< Literal lengths of literals, the
+                                        ///< following part length of names
+  char literals[TINY_PARSE_PROGRAM_LITERALS]; ///< Literal characters
+} tinyParseProgramType;
+
 /**
  * @brief Get the current unix time from a time
  *
@@ -128,6 +330,116 @@ tinyUnixType tiny_getUnixTime(const tinyTimeType *tm);
  */
 void tiny_getTimeType(tinyTimeType *tm, const tinyUnixType unixTime);
 
+/**
+ * @brief Initialize the converter context with the day of the unix epoch
+ *
+ * @param converter The reference to the converter context
+ */
+void tiny_initConverter(tinyConverterType *converter);
+
+/**
+ * @brief Convert the unix time to the human readable format incrementally
+ *
+ * Returns the same as tiny_getTimeType. Only the day time is calculated if the
+ * unix time is in the day of the last call, and the date is stepped forward if
+ * it is in the next day. Fast for sorted streams of unix times.
+ *
+ * @param converter The reference to an initialized converter context
+ * @param tm The reference to a tinyTimeType structure instance
+ * @param unixTime The unix time to convert
+ */
+void tiny_convertTimeType(tinyConverterType *converter,
+                          tinyTimeType *tm,
+                          const tinyUnixType unixTime);
+
+/**
+ * @brief Get the unix times of an array of times
+ *
+ * The arguments are checked once per batch. Invalid elements are set to
+ * UINT64_MAX like in tiny_getUnixTime and marked in the invalid map. Uses
+ * SSE4.1 and AVX2 kernels from TINY_SIMD_SSE41 on.
+ *
+ * @param unixTimes Array of count unix times to store the results
+ * @param tm Array of count base times to convert to unix time
+ * @param count The number of elements to convert
+ * @param invalidMap Bitmap of (count + 7) / 8 bytes, the bit (i % 8) of byte
+ * (i / 8) is set if element i is invalid. NULL if not needed, all elements
+ * are marked in case of NULL arrays
+ * @return size_t The number of invalid elements, count in case of NULL arrays
+ */
+size_t tiny_getUnixTimeBatch(tinyUnixType *unixTimes,
+                             const tinyTimeType *tm,
+                             const size_t count,
+                             uint8_t *invalidMap);
+
+/**
+ * @brief Get the unix times of time and date columns
+ *
+ * Same as tiny_getUnixTimeBatch for time and date fields in separate arrays.
+ * Uses the SSE4.1 or AVX2 kernels if supported by the CPU.
+ *
+ * @param unixTimes Array of count unix times to store the results
+ * @param columns The time and date arrays with count elements each
+ * @param count The number of elements to convert
+ * @param invalidMap Bitmap of (count + 7) / 8 bytes, the bit (i % 8) of byte
+ * (i / 8) is set if element i is invalid. NULL if not needed
+ * @return size_t The number of invalid elements, count in case of NULL arrays
+ */
+size_t tiny_getUnixTimeColumns(tinyUnixType *unixTimes,
+                               const tinyTimeColumnsType *columns,
+                               const size_t count,
+                               uint8_t *invalidMap);
+
+/**
+ * @brief Convert an array of unix times to the human readable format
+ *
+ * The arguments are checked once per batch. Uses SSE4.1, AVX2 and AVX-512
+ * kernels from TINY_SIMD_SSE41 on, without SIMD support it is the scalar
+ * conversion in a loop.
+ *
+ * @param tm Array of count tinyTimeType structures to store the results
+ * @param unixTimes Array of count unix times to convert
+ * @param count The number of elements to convert
+ */
+void tiny_getTimeTypeBatch(tinyTimeType *tm,
+                           const tinyUnixType *unixTimes,
+                           const size_t count);
+
+/**
+ * @brief Limits the SIMD kernels used by the batch conversions.
+ *
+ * The batch conversions use the highest level supported by the CPU by default.
+ * All levels return the same results as the scalar conversions. The level is
+ * global, do not call it while other threads are converting.
+ *
+ * @param maxLevel The highest level to use
+ * @return TINY_SIMD_LEVELS The level in use, limited by the CPU features
+ */
+TINY_SIMD_LEVELS tiny_setSimdLevel(const TINY_SIMD_LEVELS maxLevel);
+
+/**
+ * @brief Writes the time in a human readable format into the buffer.
+ *
+ * The string has the following format:
+ *
+ * ``Www dd Mmm yyyy hh:mm:ss\0``
+ *
+ * Where Www is the weekday,
+ * dd the day of the month, Mmm the month (in letters), yyyy the year
+ * and hh:mm:ss the time.
+ *
+ * Reentrant, no global state is used. A buffer of TINY_FORMAT_BUFFER_SIZE
+ * bytes holds the string of any tinyTimeType.
+ *
+ * @param buf The buffer to write the null terminated string to
+ * @param len The size of the buffer in bytes
+ * @param tm Pointer to an object of type tinyTimeType that contains a time
+ * value
+ * @return size_t The length of the written string without the null
+ * terminator, 0 in case of NULL arguments or a too small buffer
+ */
+size_t tiny_formatTo(char *buf, const size_t len, const tinyTimeType *tm);
+
 /**
  * @brief Returns a string converted human readable date format.
  *
@@ -139,7 +451,8 @@ void tiny_getTimeType(tinyTimeType *tm, const tinyUnixType unixTime);
  * dd the day of the month, Mmm the month (in letters), yyyy the year
  * and hh:mm:ss the time.
  *
- * The static c-array buffer has a size of 25.
+ * The string is written with tiny_formatTo into a static c-array buffer of
+ * TINY_FORMAT_BUFFER_SIZE bytes, which is overwritten by the next call.
  *
  * @param tm Pointer to an object of type tinyTimeType that contains a time
  * value
@@ -148,6 +461,493 @@ void tiny_getTimeType(tinyTimeType *tm, const tinyUnixType unixTime);
  */
 const char *tiny_getFormat(const tinyTimeType *tm);
 
+/**
+ * @brief Writes the human readable format of a unix time into the buffer.
+ *
+ * Writes the same string as tiny_getTimeType followed by tiny_formatTo
+ * without the intermediate tinyTimeType and its range checks.
+ *
+ * @param buf The buffer to write the null terminated string to
+ * @param len The size of the buffer in bytes, TINY_FORMAT_BUFFER_SIZE holds
+ * any unix time
+ * @param unixTime The unix time to format
+ * @return size_t The length of the written string without the null
+ * terminator, 0 in case of a NULL buffer or a too small buffer
+ */
+size_t tiny_formatUnix(char *buf, const size_t len, const tinyUnixType unixTime);
+
+/**
+ * @brief Returns the length tiny_formatTo writes for a time.
+ *
+ * Constant time, TINY_FORMAT_LENGTH for all fields in the fixed width ranges.
+ *
+ * @param tm Pointer to an object of type tinyTimeType that contains a time
+ * value
+ * @return size_t The length of the string without the null terminator, 0 in
+ * case of a NULL argument
+ */
+size_t tiny_formatLength(const tinyTimeType *tm);
+
+/**
+ * @brief Returns the length tiny_formatUnix writes for a unix time.
+ *
+ * Constant time, TINY_FORMAT_LENGTH for unix times until the year 9999.
+ *
+ * @param unixTime The unix time to format
+ * @return size_t The length of the string without the null terminator
+ */
+size_t tiny_formatUnixLength(const tinyUnixType unixTime);
+
+/**
+ * @brief Formats an array of unix times into rows with a fixed stride.
+ *
+ * Writes the tiny_getFormat string of element i without a null terminator to
+ * buf + i * stride. Bytes after the TINY_FORMAT_LENGTH characters of a row
+ * are not changed. Unix times after the year 9999 do not fit the fixed width,
+ * their rows are filled with spaces and marked in the invalid map. The digits
+ * of two rows at once are written with AVX2 shuffles from TINY_SIMD_AVX2 on.
+ *
+ * @param buf The buffer of count * stride bytes
+ * @param stride The distance of the rows, at least TINY_FORMAT_LENGTH
+ * @param unixTimes Array of count unix times to format
+ * @param count The number of elements to format
+ * @param invalidMap Bitmap of (count + 7) / 8 bytes, the bit (i % 8) of byte
+ * (i / 8) is set if element i is invalid. NULL if not needed
+ * @return size_t The number of invalid elements, count in case of NULL arrays
+ * or a too small stride
+ */
+size_t tiny_formatBatch(char *buf,
+                        const size_t stride,
+                        const tinyUnixType *unixTimes,
+                        const size_t count,
+                        uint8_t *invalidMap);
+
+/**
+ * @brief Formats an array of unix times into an Arrow like string column.
+ *
+ * Writes the tiny_getFormat strings of all elements without null terminators
+ * one after another to data. The string of element i ranges from offsets[i]
+ * to offsets[i + 1], like the offsets of an Arrow string array.
+ *
+ * @param data The buffer of the string data
+ * @param dataLen The size of the data buffer, count * TINY_FORMAT_LENGTH is
+ * enough for times until the year 9999
+ * @param offsets Array of count + 1 offsets into the data buffer
+ * @param unixTimes Array of count unix times to format
+ * @param count The number of elements to format
+ * @return size_t The number of formatted elements, smaller than count if the
+ * data buffer is full. 0 in case of NULL arrays
+ */
+size_t tiny_formatBatchOffsets(char *data,
+                               const size_t dataLen,
+                               int32_t *offsets,
+                               const tinyUnixType *unixTimes,
+                               const size_t count);
+
+/**
+ * @brief Parses a string of the tiny_getFormat layout.
+ *
+ * Reads the TINY_FORMAT_LENGTH characters of ``Www dd Mmm yyyy hh:mm:ss``
+ * from the start of the string, characters after them are ignored. The
+ * weekday has to match the date. Fills all fields of the time type, so it is
+ * accepted by tiny_getUnixTime.
+ *
+ * @param str The string to parse, not null terminated
+ * @param len The number of characters of the string
+ * @param tm The reference to the structure to fill, unchanged on errors
+ * @return uint8_t 1 if parsed, 0 in case of NULL arguments, a too short
+ * string, a different layout, an invalid date or a wrong weekday
+ */
+uint8_t tiny_parseFormat(const char *str, const size_t len, tinyTimeType *tm);
+
+/**
+ * @brief Parses a RFC 3164 syslog timestamp without year.
+ *
+ * Reads the TINY_SYSLOG_LENGTH characters of ``Mmm dd hh:mm:ss`` from the
+ * start of the string, the month day is padded with a space. The year is
+ * inferred from the reference time: the timestamp is expected at most one
+ * month after it, so a december timestamp at a january reference is from the
+ * previous year and a january timestamp at a december reference from the
+ * next one. Fills all fields of the time type.
+ *
+ * @param str The string to parse, not null terminated
+ * @param len The number of characters of the string
+ * @param refTime The reference unix time, e.g. the receive time
+ * @param tm The reference to the structure to fill, unchanged on errors
+ * @return uint8_t 1 if parsed, 0 in case of NULL arguments, a too short
+ * string, a different layout or an invalid date in the inferred year
+ */
+uint8_t tiny_parseSyslog(const char *str,
+                         const size_t len,
+                         const tinyUnixType refTime,
+                         tinyTimeType *tm);
+
+/**
+ * @brief Parses the RFC 3164 timestamps of a chunk of lines.
+ *
+ * Same as tiny_parseSyslog for all lines of an Arrow like string column, the
+ * line i ranges from offsets[i] to offsets[i + 1] in data. The reference
+ * time is converted once and the year of a month is only inferred if the
+ * month differs from the one of the previous line, which makes sorted chunks
+ * cheapest. Invalid lines are set to UINT64_MAX like in tiny_getUnixTime and
+ * marked in the invalid map.
+ *
+ * @param unixTimes Array of count unix times to store the results
+ * @param data The string data of the lines
+ * @param offsets Array of count + 1 offsets into the data
+ * @param count The number of lines to parse
+ * @param refTime The reference unix time, e.g. the receive time
+ * @param invalidMap Bitmap of (count + 7) / 8 bytes, the bit (i % 8) of byte
+ * (i / 8) is set if line i is invalid. NULL if not needed
+ * @return size_t The number of invalid lines, count in case of NULL arrays
+ */
+size_t tiny_parseSyslogBatch(tinyUnixType *unixTimes,
+                             const char *data,
+                             const int32_t *offsets,
+                             const size_t count,
+                             const tinyUnixType refTime,
+                             uint8_t *invalidMap);
+
+/**
+ * @brief Parses a decimal epoch timestamp string.
+ *
+ * Reads the leading digits of the string, characters after them are ignored.
+ * The digits are converted 8 per word. TINY_EPOCH_AUTO detects the unit by
+ * the number of digits: up to 11 are seconds, up to 14 milliseconds, up to
+ * 17 microseconds and up to 20 nanoseconds. This holds for times from 1973
+ * until the year 5138.
+ *
+ * @param str The string to parse, not null terminated
+ * @param len The number of characters of the string
+ * @param unit The unit of the timestamp or TINY_EPOCH_AUTO
+ * @param nanoSec Reference to store the nanoseconds after the second, NULL
+ * if not needed. Unchanged on errors
+ * @return tinyUnixType The unix time in seconds or UINT64_MAX in case of a
+ * NULL string, an invalid unit, no digits or more than UINT64_MAX
+ */
+tinyUnixType tiny_parseEpoch(const char *str,
+                             const size_t len,
+                             const TINY_EPOCH_UNITS unit,
+                             uint32_t *nanoSec);
+
+/**
+ * @brief Initialize the format cache with the unix epoch
+ *
+ * @param cache The reference to the format cache
+ */
+void tiny_initFormatCache(tinyFormatCacheType *cache);
+
+/**
+ * @brief Returns the tiny_getFormat string of the unix time from a cache.
+ *
+ * Returns the cached string if the unix time did not change. Within the same
+ * day only the hh:mm:ss digits of the string are patched, otherwise the time
+ * is converted with tiny_getTimeType and formatted with tiny_formatTo.
+ *
+ * @param cache The reference to an initialized format cache
+ * @param unixTime The unix time to format
+ * @return The C-string in the cache, valid until the next call with the cache.
+ * NULL in case of a NULL cache
+ */
+const char *tiny_getFormatCached(tinyFormatCacheType *cache,
+                                 const tinyUnixType unixTime);
+
+/**
+ * @brief Formats a unix time as RFC 3339 string.
+ *
+ * Writes ``YYYY-MM-DDTHH:MM:SS[.f...](Z|+hh:mm|-hh:mm)`` with the local time
+ * of the UTC offset. The fraction is truncated to the given digits, e.g. 3
+ * for milliseconds, 6 for microseconds or 9 for nanoseconds. An offset of 0
+ * is written as Z.
+ *
+ * @param buf The buffer to write the null terminated string to
+ * @param len The size of the buffer, TINY_RFC3339_BUFFER_SIZE fits any string
+ * @param unixTime The unix time to format
+ * @param nanoSec The nanoseconds of the second ranged from 0 - 999999999
+ * @param fractionDigits The number of fraction digits, 0 without fraction
+ * @param offsetMin The UTC offset in minutes ranged from
+ * -TINY_RFC3339_MAX_OFFSET to TINY_RFC3339_MAX_OFFSET
+ * @return size_t The length of the string without the null terminator. 0 in
+ * case of a NULL buffer, a too small buffer, invalid arguments or a local
+ * time before the unix epoch or after the year 9999, an empty string is
+ * written if possible
+ */
+size_t tiny_formatRfc3339(char *buf,
+                          const size_t len,
+                          const tinyUnixType unixTime,
+                          const uint32_t nanoSec,
+                          const uint8_t fractionDigits,
+                          const int16_t offsetMin);
+
+/**
+ * @brief Returns the length tiny_formatRfc3339 writes.
+ *
+ * The length only depends on the fraction digits and if there is an offset,
+ * it is the same for every unix time tiny_formatRfc3339 accepts.
+ *
+ * @param fractionDigits The number of fraction digits from 0 to
+ * TINY_RFC3339_MAX_FRACTION
+ * @param offsetMin The UTC offset in minutes
+ * @return size_t The length of the string without the null terminator, 0 in
+ * case of invalid arguments
+ */
+size_t tiny_formatRfc3339Length(const uint8_t fractionDigits,
+                                const int16_t offsetMin);
+
+/**
+ * @brief Parses a RFC 3339 timestamp into a unix time.
+ *
+ * Reads ``YYYY-MM-DDTHH:MM:SS[.fraction](Z|+hh:mm|-hh:mm)`` from the start
+ * of the string, characters after it are ignored. T and Z may be lower case.
+ * The fraction has at least one digit, digits after the nanoseconds are cut
+ * off. The date and time are validated like tiny_getUnixTime and the UTC time
+ * must not be before the unix epoch. Uses SSE4.1 from TINY_SIMD_SSE41 on.
+ *
+ * @param str The string to parse, not null terminated
+ * @param len The number of characters of the string
+ * @param unixTime Reference to store the UTC unix time
+ * @param nanoSec Reference to store the nanoseconds, NULL if not needed
+ * @param offsetMin Reference to store the UTC offset in minutes, NULL if not
+ * needed
+ * @return size_t The number of parsed characters, 0 in case of NULL
+ * arguments or an invalid timestamp
+ */
+size_t tiny_parseRfc3339(const char *str,
+                         const size_t len,
+                         tinyUnixType *unixTime,
+                         uint32_t *nanoSec,
+                         int16_t *offsetMin);
+
+/**
+ * @brief Initialize an empty parse cache
+ *
+ * @param cache The reference to the parse cache
+ */
+void tiny_initParseCache(tinyParseCacheType *cache);
+
+/**
+ * @brief Parses a string of the tiny_getFormat layout with a parse cache.
+ *
+ * Same as tiny_parseFormat and tiny_getUnixTime. If the 16 characters of
+ * ``Www dd Mmm yyyy `` equal the ones of the last parsed string, only the
+ * time of the day is parsed and added to the cached date. Sorted log lines
+ * mostly share the date of the previous line.
+ *
+ * @param cache The reference to an initialized parse cache
+ * @param str The string to parse, not null terminated
+ * @param len The number of characters of the string
+ * @param unixTime Reference to store the unix time
+ * @return uint8_t 1 if parsed, 0 in case of NULL arguments or an invalid
+ * string
+ */
+uint8_t tiny_parseFormatCached(tinyParseCacheType *cache,
+                               const char *str,
+                               const size_t len,
+                               tinyUnixType *unixTime);
+
+/**
+ * @brief Parses a RFC 3339 timestamp with a parse cache.
+ *
+ * Same as tiny_parseRfc3339. If the characters of ``YYYY-MM-DDT`` equal the
+ * ones of the last parsed string, only the time of the day, the fraction and
+ * the offset are parsed.
+ *
+ * @param cache The reference to an initialized parse cache
+ * @param str The string to parse, not null terminated
+ * @param len The number of characters of the string
+ * @param unixTime Reference to store the UTC unix time
+ * @param nanoSec Reference to store the nanoseconds, NULL if not needed
+ * @param offsetMin Reference to store the UTC offset in minutes, NULL if not
+ * needed
+ * @return size_t The number of parsed characters, 0 in case of NULL
+ * arguments or an invalid timestamp
+ */
+size_t tiny_parseRfc3339Cached(tinyParseCacheType *cache,
+                               const char *str,
+                               const size_t len,
+                               tinyUnixType *unixTime,
+                               uint32_t *nanoSec,
+                               int16_t *offsetMin);
+
+/**
+ * @brief Initialize an empty stream parser
+ *
+ * @param parser The reference to the stream parser
+ */
+void tiny_initStreamParser(tinyStreamParserType *parser);
+
+/**
+ * @brief Parses the timestamps of lines fed in chunks of any size.
+ *
+ * Every line of the stream starts with a RFC 3339 timestamp or a timestamp of
+ * the tiny_getFormat layout, which has to end within the first
+ * TINY_STREAM_WINDOW characters. The rest of the line is skipped. Stores one
+ * unix time per line once the line ends or its first TINY_STREAM_WINDOW
+ * characters arrived, UINT64_MAX for lines without a valid timestamp. The
+ * timestamps are parsed in place, only the start of a line split by the end
+ * of a chunk is copied into the parser. Lines of the same date only parse
+ * the time of the day like tiny_parseFormatCached.
+ *
+ * @param parser The reference to an initialized stream parser
+ * @param unixTimes Array to store the unix times of the completed lines
+ * @param count The number of elements of the array
+ * @param data The next chunk of the stream
+ * @param len The number of characters of the chunk
+ * @param used Reference to store the number of used characters, less than
+ * len if the array is full. Feed the rest of the chunk again
+ * @return size_t The number of stored unix times, 0 in case of NULL arguments
+ */
+size_t tiny_parseStream(tinyStreamParserType *parser,
+                        tinyUnixType *unixTimes,
+                        const size_t count,
+                        const char *data,
+                        const size_t len,
+                        size_t *used);
+
+/**
+ * @brief Parses the last line of a stream without a newline.
+ *
+ * Resets the parser for a new stream, the date cache is kept.
+ *
+ * @param parser The reference to a stream parser
+ * @param unixTime Reference to store the unix time of the line, UINT64_MAX
+ * without a valid timestamp
+ * @return uint8_t 1 if a line was pending, 0 otherwise or in case of NULL
+ * arguments
+ */
+uint8_t tiny_finishStream(tinyStreamParserType *parser, tinyUnixType *unixTime);
+
+/**
+ * @brief Formats a unix time as RFC 7231 IMF-fixdate string.
+ *
+ * Writes the HTTP date format, e.g. ``Sun, 06 Nov 1994 08:49:37 GMT``.
+ *
+ * @param buf The buffer to write the null terminated string to
+ * @param len The size of the buffer, at least TINY_HTTP_DATE_LENGTH + 1
+ * @param unixTime The unix time to format
+ * @return size_t TINY_HTTP_DATE_LENGTH or 0 in case of a NULL or too small
+ * buffer or a time after the year 9999, an empty string is written if possible
+ */
+size_t tiny_formatHttpDate(char *buf,
+                           const size_t len,
+                           const tinyUnixType unixTime);
+
+#ifdef __GNUC__
+/**
+ * @brief Initialize the shared HTTP date with the unix epoch
+ *
+ * Must not be called while other threads use the shared date.
+ *
+ * @param date The reference to the shared HTTP date
+ */
+void tiny_initHttpDate(tinyHttpDateType *date);
+
+/**
+ * @brief Copies the IMF-fixdate string of the current second.
+ *
+ * Returns the published string if it holds the current second. Otherwise the
+ * first caller of a new second publishes it, callers during the update
+ * format the string themselves. Thread safe and lock free.
+ *
+ * @param date The reference to an initialized shared HTTP date
+ * @param now The current unix time
+ * @param buf The buffer to write the null terminated string to
+ * @param len The size of the buffer, at least TINY_HTTP_DATE_LENGTH + 1
+ * @return size_t TINY_HTTP_DATE_LENGTH or 0 in case of NULL arguments, a too
+ * small buffer or a time after the year 9999
+ */
+size_t tiny_getHttpDate(tinyHttpDateType *date,
+                        const tinyUnixType now,
+                        char *buf,
+                        const size_t len);
+#endif
+
+/**
+ * @brief Compiles a strftime like pattern into a format program.
+ *
+ * Supported conversions are %a %A %b %B %h %c %C %d %D %e %F %H %I %j %m %M
+ * %n %p %R %S %t %T %u %U %w %W %x %X %y %Y and %%, with the output of the C
+ * locale. All other characters are copied.
+ *
+ * @param prog The reference to the program to compile
+ * @param pattern The C-string of the pattern
+ * @return uint8_t 1 if compiled, 0 in case of NULL arguments, unsupported
+ * conversions or a pattern exceeding the program limits
+ */
+uint8_t tiny_formatCompile(tinyFormatProgramType *prog, const char *pattern);
+
+/**
+ * @brief Formats a time with a compiled format program.
+ *
+ * @param prog The reference to a program compiled by tiny_formatCompile
+ * @param tm The time to format
+ * @param buf The buffer to write the null terminated string to
+ * @param len The size of the buffer
+ * @return size_t The length of the string without the null terminator. 0 in
+ * case of NULL arguments or a too small buffer, an empty string is written if
+ * possible
+ */
+size_t tiny_formatRun(const tinyFormatProgramType *prog,
+                      const tinyTimeType *tm,
+                      char *buf,
+                      const size_t len);
+
+/**
+ * @brief Returns the length tiny_formatRun writes for a time.
+ *
+ * Constant time for the times of unix times until the year 9999 if the
+ * program has no full weak day or month names, otherwise the operations are
+ * summed up without writing.
+ *
+ * @param prog The compiled program
+ * @param tm Pointer to an object of type tinyTimeType that contains a time
+ * value
+ * @return size_t The length of the string without the null terminator, 0 in
+ * case of NULL arguments
+ */
+size_t tiny_formatRunLength(const tinyFormatProgramType *prog,
+                            const tinyTimeType *tm);
+
+/**
+ * @brief Compiles a strptime like pattern into a parse program.
+ *
+ * Supported conversions are %a %A %b %B %h %c %d %D %e %F %H %I %m %M %n %p
+ * %R %S %t %T %u %w %x %X %y %Y %z and %%, with the names of the C locale in
+ * any case. All other characters have to match exactly. Unlike strptime,
+ * the fields have a fixed width: two digits, four for %Y, the abbreviated
+ * names for %a and %b, the full names for %A and %B and +hhmm or -hhmm for
+ * %z. Two digit years below 69 are in the 21st century.
+ *
+ * @param prog The reference to the program to compile
+ * @param pattern The C-string of the pattern
+ * @return uint8_t 1 if compiled, 0 in case of NULL arguments, an empty
+ * pattern, unsupported conversions or more than TINY_PARSE_PROGRAM_OPS
+ * operations, TINY_PARSE_PROGRAM_LITERALS literals or
+ * TINY_PARSE_PROGRAM_LENGTH characters between full names
+ */
+uint8_t tiny_parseCompile(tinyParseProgramType *prog, const char *pattern);
+
+/**
+ * @brief Parses a string with a compiled parse program.
+ *
+ * Characters after the pattern are ignored. Fields missing in the pattern
+ * are taken from 1.1.1970 00:00:00. The date and time are validated like
+ * tiny_getUnixTime and a weak day has to match the date. With %z the time is
+ * converted to UTC, which must not be before the unix epoch. Fills all fields
+ * of the time type.
+ *
+ * @param prog The compiled program
+ * @param str The string to parse, not null terminated
+ * @param len The number of characters of the string
+ * @param tm The reference to the structure to fill, unchanged on errors
+ * @return size_t The number of parsed characters, 0 in case of NULL
+ * arguments, a not compiled program or a string not matching the pattern
+ */
+size_t tiny_parseRun(const tinyParseProgramType *prog,
+                     const char *str,
+                     const size_t len,
+                     tinyTimeType *tm);
+
 /**
  * @brief Checks if the given year is a leap year.
  *
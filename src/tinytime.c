@@ -23,13 +23,45 @@
 
 #include "tinytime.h"
 #include <stddef.h>
-#include <stdio.h>
+#include <string.h>
+
+#if defined(__x86_64__) && defined(__GNUC__) && !defined(TINY_TIME_NO_SIMD)
+#define TINY_TIME_X86_SIMD ///< Compile the x86 SIMD kernels
+#include <immintrin.h>
+#endif
 
 #define LEAP_YEAR_FREQUENCY (4)    ///< Frequency of a leap year
 #define LEAP_YEAR_REMOVED (100)    ///< Removed leap year every century
 #define LEAP_YEAR_CORRECTION (400) ///< Not removed leap year every 4 centuries
 #define MONTH_DAY_OFFSET (1)       ///< Month day starts at 1
 
+#define ERA_DAYS (146097U)              ///< Days of a 400 year era
+#define CENTURY_DAYS (36524U)           ///< Days of a century without 400 leap
+#define FOUR_YEARS_DAYS (1460U)         ///< Days of 4 years without leap day
+#define ERA_EPOCH_OFFSET_DAYS (719468U) ///< Days from 1.3.0000 to 1.1.1970
+#define JAN_AND_FEB_DAYS (59U)           ///< Days of january and february
+#define SHIFTED_MONTHS_TO_JAN (10U) ///< Months from march to january
+#define SHIFTED_MONTH_DAYS (153U)   ///< Days of 5 month from march to july
+#define SHIFTED_MONTH_DAYS_DIVISOR (5U) ///< Months of the 153 days pattern
+#define SHIFTED_MONTH_ROUNDING (2U) ///< Rounding of the 153 days pattern
+#define UNIX_EPOCH_LEAP_DAYS (477U) ///< Leap days from year 1 to 1969
+#define ERA_DAY_TO_WEAK_DAY (3U)    ///< Weak day offset of the era day
+#define INVALID_MAP_BITS (8U)       ///< Elements per byte of an invalid map
+#define BYTE_ALL_BITS (0xFF)        ///< All bits of an invalid map byte
+#define ERROR_VALUE (UINT64_MAX)    ///< Unix time returned for invalid dates
+#define MONTH_BASE_DAYS (30U)       ///< Days of a month without the 31st
+#define FEB_DAYS (28U)              ///< Days of february without leap day
+
+/*
+ * Constant divisors with their reciprocal multiplier and shift. For dividends
+ * smaller than 256 times the divisor the product fits into 32 bits and the
+ * quotient is at most 2 too small.
+ */
+#define MIN_DIVISOR TINY_ONE_MIN_IN_SEC, 0x00044444U, 24U   ///< Minute divisor
+#define HOUR_DIVISOR TINY_ONE_HOUR_IN_SEC, 0x00001234U, 24U ///< Hour divisor
+#define DAY_DIVISOR TINY_ONE_DAY_IN_SEC, 0x000000C2U, 24U   ///< Day divisor
+#define ERA_DIVISOR ERA_DAYS, 0x00000072U, 24U              ///< Era divisor
+
 /**
  * @brief Checks if the check value is in range from min and max
  *
@@ -48,52 +80,354 @@
  */
 #define IS_SMALLER(CHECK, MIN) ((CHECK) < (MIN))
 
-tinyUnixType tiny_getUnixTime(const tinyTimeType *tm)
-{
-#define CENTURY_CORRECTION_OFFSET (1900)
-#define FOUR_CENTURY_CORRECTION_OFFSET (1600)
-#define FIRST_LEAP_YEAR_OFFSET (1)
-#define ERROR_VALUE (UINT64_MAX)
+#define DECIMAL_BASE (10U)    ///< Base of decimal numbers
+#define DIGIT_PAIRS (100U)    ///< Number of two digit pairs
+#define MAX_DIGIT_PAIR (99U)  ///< Biggest value of a two digit pair
+#define MIN_FOUR_DIGITS (1000U) ///< Smallest number with four digits
+#define MAX_FOUR_DIGITS (9999U) ///< Biggest number with four digits
+#define MAX_FOUR_DIGITS_UNIX_TIME                                              \
+  ((tinyUnixType)253402300799U) ///< Unix time of 31.12.9999 23:59:59
+#define NAME_LENGTH (3U)      ///< Letters of weak day and month names
+#define MAX_YEAR_DAY (366U)   ///< Last day of a leap year
 
-  if (NULL == tm) {
-    return ERROR_VALUE;
-  }
-  // Check valid time
-  if (IS_BIGGER(tm->sec, TINY_SEC_MAX) || IS_BIGGER(tm->min, TINY_MINUTE_MAX) ||
-      IS_BIGGER(tm->hour, TINY_HOUR_MAX)) {
-    return ERROR_VALUE;
-  }
-  // Check valid year
-  if (IS_SMALLER(tm->year, TINY_UNIX_YEAR_BEGIN)) {
-    return ERROR_VALUE;
+#define FORMAT_WEAK_DAY (0U)   ///< Offset of the weak day in the format
+#define FORMAT_MONTH_DAY (4U)  ///< Offset of the month day in the format
+#define FORMAT_MONTH (7U)      ///< Offset of the month in the format
+#define FORMAT_YEAR (11U)      ///< Offset of the year in the format
+#define FORMAT_HOUR (16U)      ///< Offset of the hour in the format
+#define FORMAT_MIN (19U)       ///< Offset of the minutes in the format
+#define FORMAT_SEC (22U)       ///< Offset of the seconds in the format
+#define FORMAT_TIME_LENGTH (8U) ///< Length of hh:mm:ss at the format end
+#define FORMAT_BATCH_CHUNK (32U) ///< Times converted at once by the batches
+
+#define RFC3339_YEAR (0U)           ///< Offset of the year in RFC 3339
+#define RFC3339_MONTH (5U)          ///< Offset of the month in RFC 3339
+#define RFC3339_MONTH_DAY (8U)      ///< Offset of the month day in RFC 3339
+#define RFC3339_HOUR (11U)          ///< Offset of the hour in RFC 3339
+#define RFC3339_MIN (14U)           ///< Offset of the minutes in RFC 3339
+#define RFC3339_SEC (17U)           ///< Offset of the seconds in RFC 3339
+#define RFC3339_TIME_LENGTH (19U)   ///< Length of the date and time part
+#define RFC3339_OFFSET_LENGTH (6U)  ///< Length of a +hh:mm offset
+#define MAX_NANO_SEC (999999999U)   ///< Biggest nanoseconds of a second
+
+#define HTTP_DATE_WEAK_DAY (0U)   ///< Offset of the weak day in IMF-fixdate
+#define HTTP_DATE_MONTH_DAY (5U)  ///< Offset of the month day in IMF-fixdate
+#define HTTP_DATE_MONTH (8U)      ///< Offset of the month in IMF-fixdate
+#define HTTP_DATE_YEAR (12U)      ///< Offset of the year in IMF-fixdate
+#define HTTP_DATE_HOUR (17U)      ///< Offset of the hour in IMF-fixdate
+#define HTTP_DATE_MIN (20U)       ///< Offset of the minutes in IMF-fixdate
+#define HTTP_DATE_SEC (23U)       ///< Offset of the seconds in IMF-fixdate
+#define HTTP_DATE_ZONE (25U)      ///< Offset of the GMT zone in IMF-fixdate
+#define UINT32_BITS (32U)         ///< Bits of a 32 bit word
+#define HTTP_DATE_WORDS                                                        \
+  (TINY_HTTP_DATE_BUFFER_SIZE / sizeof(uint32_t)) ///< Words of a shared date
+
+/**
+ * @brief Returns the two ASCII digits of a value from 0 to 99
+ *
+ */
+#define DIGIT_PAIR(VALUE) (&digitPairs[2U * (VALUE)])
+
+/**
+ * @brief The two ASCII digits of all values from 0 to 99
+ *
+ */
+static const char digitPairs[2U * DIGIT_PAIRS] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+/**
+ * @brief The three letter names of the weak days
+ *
+ */
+static const char weakDayNames[TINY_MAX_WEAKDAYS][NAME_LENGTH] = {
+    [TINY_SUN] = {'S', 'u', 'n'}, [TINY_MON] = {'M', 'o', 'n'},
+    [TINY_TUE] = {'T', 'u', 'e'}, [TINY_WED] = {'W', 'e', 'd'},
+    [TINY_THU] = {'T', 'h', 'u'}, [TINY_FRI] = {'F', 'r', 'i'},
+    [TINY_SAT] = {'S', 'a', 't'}};
+
+/**
+ * @brief The three letter names of the months
+ *
+ */
+static const char monthNames[TINY_MAX_MONTHS - TINY_JAN][NAME_LENGTH] = {
+    [TINY_JAN - TINY_JAN] = {'J', 'a', 'n'},
+    [TINY_FEB - TINY_JAN] = {'F', 'e', 'b'},
+    [TINY_MAR - TINY_JAN] = {'M', 'a', 'r'},
+    [TINY_APR - TINY_JAN] = {'A', 'p', 'r'},
+    [TINY_MAY - TINY_JAN] = {'M', 'a', 'y'},
+    [TINY_JUN - TINY_JAN] = {'J', 'u', 'n'},
+    [TINY_JUL - TINY_JAN] = {'J', 'u', 'l'},
+    [TINY_AUG - TINY_JAN] = {'A', 'u', 'g'},
+    [TINY_SEP - TINY_JAN] = {'S', 'e', 'p'},
+    [TINY_OCT - TINY_JAN] = {'O', 'c', 't'},
+    [TINY_NOV - TINY_JAN] = {'N', 'o', 'v'},
+    [TINY_DEC - TINY_JAN] = {'D', 'e', 'c'}};
+
+/**
+ * @brief Divides the dividend by a constant divisor.
+ *
+ * With TINY_TIME_NO_DIV64 defined, the division is done as long division over
+ * 8 bit digits with a 32 bit reciprocal multiplication per digit and two
+ * branch free corrections. This avoids the software 64 bit division and
+ * multiplication on targets without a 64 bit divider.
+ * Otherwise the native division is used.
+ *
+ * @param dividend The value to divide
+ * @param divisor The constant divisor
+ * @param magic The reciprocal multiplier of the divisor
+ * @param shift The reciprocal shift of the divisor
+ * @param remainder Reference to store the remainder of the division
+ * @return uint64_t The quotient of the division
+ */
+static inline uint64_t tiny_divide(const uint64_t dividend,
+                                   const uint32_t divisor,
+                                   const uint32_t magic,
+                                   const uint8_t shift,
+                                   uint32_t *remainder)
+{
+#ifdef TINY_TIME_NO_DIV64
+#define DIGIT_BITS (8U)
+#define DIGIT_MASK (0xFFU)
+#define DIGIT_COUNT (8U)
+#define DIGIT_CORRECTIONS (2U)
+  uint64_t quotient = 0;
+  uint32_t rest = 0;
+  for (uint8_t i = DIGIT_COUNT; i > 0; i--) {
+    const uint32_t part =
+        (rest << DIGIT_BITS) |
+        ((uint32_t)(dividend >> ((i - 1U) * DIGIT_BITS)) & DIGIT_MASK);
+    // The part is smaller than 256 times the divisor, so is the product
+    uint32_t digit = (part * magic) >> shift;
+    rest = part - digit * divisor;
+    for (uint8_t k = 0; k < DIGIT_CORRECTIONS; k++) {
+      const uint32_t isTooSmall = (uint32_t)(rest >= divisor);
+      digit += isTooSmall;
+      rest -= isTooSmall * divisor;
+    }
+    quotient = (quotient << DIGIT_BITS) | digit;
   }
-  // Checks a valid day and month
-  if (IS_NOT_IN_RANGE(tm->monthDay, MONTH_DAY_OFFSET,
-                      tiny_getMonthDays(tm->year, tm->month))) {
+  *remainder = rest;
+  return quotient;
+#else
+  (void)magic;
+  (void)shift;
+  const uint64_t quotient = dividend / divisor;
+  *remainder = (uint32_t)(dividend - quotient * divisor);
+  return quotient;
+#endif
+}
+
+/**
+ * @brief Converts the days since 1.1.1970 into the civil date fields.
+ *
+ * Closed form calculation based on 400 year eras with a year starting at the
+ * first of march, so the leap day is always the last day of the shifted year.
+ * Runs in a fixed number of operations for any day count.
+ * Sets year, month, monthDay, yearDay and weakDay of the tm structure.
+ *
+ * @param tm The reference to the structure to fill
+ * @param days The days since the unix epoch
+ */
+static void tiny_daysToCivil(tinyTimeType *tm, const uint64_t days)
+{
+  uint32_t eraDay;
+  const uint64_t era =
+      tiny_divide(days + ERA_EPOCH_OFFSET_DAYS, ERA_DIVISOR, &eraDay);
+  // Year of the era, corrected for the leap days of 4, 100 and 400 years
+  const uint32_t eraYear =
+      (eraDay - eraDay / FOUR_YEARS_DAYS + eraDay / CENTURY_DAYS -
+       eraDay / (ERA_DAYS - 1)) /
+      TINY_ONE_YEAR_IN_DAYS;
+  // Day of the shifted year starting at the first of march
+  const uint32_t shiftedYearDay =
+      eraDay - (TINY_ONE_YEAR_IN_DAYS * eraYear + eraYear / LEAP_YEAR_FREQUENCY -
+                eraYear / LEAP_YEAR_REMOVED);
+  // Month starting at march = 0 with the 153 days per 5 month pattern
+  const uint32_t shiftedMonth =
+      (SHIFTED_MONTH_DAYS_DIVISOR * shiftedYearDay + SHIFTED_MONTH_ROUNDING) /
+      SHIFTED_MONTH_DAYS;
+  const uint32_t isJanOrFeb = (uint32_t)(shiftedMonth >= SHIFTED_MONTHS_TO_JAN);
+  // The year has 16 bits, the lower 32 bits of the era are enough
+  const uint16_t year = (uint16_t)((uint32_t)era * LEAP_YEAR_CORRECTION +
+                                   eraYear + isJanOrFeb);
+  const uint32_t leapDay = tiny_isLeapYear(year);
+
+  tm->year = year;
+  // An era has whole weeks, the era day is enough for the weak day
+  tm->weakDay = (uint8_t)((eraDay + ERA_DAY_TO_WEAK_DAY) % TINY_MAX_WEAKDAYS);
+  tm->monthDay =
+      (uint8_t)(shiftedYearDay -
+                (SHIFTED_MONTH_DAYS * shiftedMonth + SHIFTED_MONTH_ROUNDING) /
+                    SHIFTED_MONTH_DAYS_DIVISOR +
+                MONTH_DAY_OFFSET);
+  // Wrap january and february into the next year without branches
+  tm->month = (uint8_t)(shiftedMonth + TINY_MAR -
+                        isJanOrFeb * (TINY_MAX_MONTHS - TINY_JAN));
+  tm->yearDay = (uint16_t)(shiftedYearDay + JAN_AND_FEB_DAYS + leapDay -
+                           isJanOrFeb * (TINY_ONE_YEAR_IN_DAYS + leapDay) +
+                           MONTH_DAY_OFFSET);
+}
+
+/**
+ * @brief Days of the months without leap day.
+ *
+ */
+static const uint8_t daysPerMonth[TINY_MAX_MONTHS - TINY_JAN] = {
+    [TINY_JAN - TINY_JAN] = 31, [TINY_FEB - TINY_JAN] = 28,
+    [TINY_MAR - TINY_JAN] = 31, [TINY_APR - TINY_JAN] = 30,
+    [TINY_MAY - TINY_JAN] = 31, [TINY_JUN - TINY_JAN] = 30,
+    [TINY_JUL - TINY_JAN] = 31, [TINY_AUG - TINY_JAN] = 31,
+    [TINY_SEP - TINY_JAN] = 30, [TINY_OCT - TINY_JAN] = 31,
+    [TINY_NOV - TINY_JAN] = 30, [TINY_DEC - TINY_JAN] = 31};
+
+/**
+ * @brief Days of the year before the first day of the months without leap day.
+ *
+ */
+static const uint16_t cumulativeMonthDays[TINY_MAX_MONTHS - TINY_JAN] = {
+    [TINY_JAN - TINY_JAN] = 0,   [TINY_FEB - TINY_JAN] = 31,
+    [TINY_MAR - TINY_JAN] = 59,  [TINY_APR - TINY_JAN] = 90,
+    [TINY_MAY - TINY_JAN] = 120, [TINY_JUN - TINY_JAN] = 151,
+    [TINY_JUL - TINY_JAN] = 181, [TINY_AUG - TINY_JAN] = 212,
+    [TINY_SEP - TINY_JAN] = 243, [TINY_OCT - TINY_JAN] = 273,
+    [TINY_NOV - TINY_JAN] = 304, [TINY_DEC - TINY_JAN] = 334};
+
+/**
+ * @brief Returns the day of the year of a valid civil date.
+ *
+ * @param year The year
+ * @param month The month ranged from TINY_JAN to TINY_DEC
+ * @param monthDay The day of the month starting at 1
+ * @return uint16_t The day of the year starting at 1
+ */
+static inline uint16_t tiny_getYearDay(const uint16_t year,
+                                       const uint8_t month,
+                                       const uint8_t monthDay)
+{
+  // Leap day of the current year only counts after february
+  const uint32_t currentLeapDay =
+      (uint32_t)(month > TINY_FEB) & tiny_isLeapYear(year);
+  return (uint16_t)(cumulativeMonthDays[month - TINY_JAN] + currentLeapDay +
+                    monthDay);
+}
+
+/**
+ * @brief Returns the days from 1.1.1970 to the first day of a year.
+ *
+ * @param year The year, not smaller than TINY_UNIX_YEAR_BEGIN
+ * @return uint32_t The days since the unix epoch
+ */
+static inline uint32_t tiny_yearToDays(const uint16_t year)
+{
+  // Leap days of all years before the year, without the ones of 1969
+  const uint32_t lastYear = (uint32_t)year - 1U;
+  const uint32_t leapDays = lastYear / LEAP_YEAR_FREQUENCY -
+                            lastYear / LEAP_YEAR_REMOVED +
+                            lastYear / LEAP_YEAR_CORRECTION -
+                            UNIX_EPOCH_LEAP_DAYS;
+  return ((uint32_t)year - TINY_UNIX_YEAR_BEGIN) * TINY_ONE_YEAR_IN_DAYS +
+         leapDays;
+}
+
+/**
+ * @brief Converts a valid civil date into the days since 1.1.1970.
+ *
+ * Closed form calculation with the leap days before the year and cumulative
+ * month offsets. The date must be validated by the caller.
+ *
+ * @param year The year, not smaller than TINY_UNIX_YEAR_BEGIN
+ * @param month The month ranged from TINY_JAN to TINY_DEC
+ * @param monthDay The day of the month starting at 1
+ * @return uint32_t The days since the unix epoch
+ */
+static uint32_t tiny_civilToDays(const uint16_t year,
+                                 const uint8_t month,
+                                 const uint8_t monthDay)
+{
+  return tiny_yearToDays(year) + tiny_getYearDay(year, month, monthDay) -
+         MONTH_DAY_OFFSET;
+}
+
+/**
+ * @brief Converts the time and date fields to unix time.
+ *
+ * @param year The year since year 0
+ * @param month The month ranged from 1 - 12
+ * @param monthDay The day of the month starting at 1
+ * @param hour The hour ranged from 0 - 23
+ * @param min The minute ranged from 0 - 59
+ * @param sec The second ranged from 0 - 59
+ * @return tinyUnixType Unix time of the fields or ERROR_VALUE in case of an
+ * invalid time or date
+ */
+static inline tinyUnixType tiny_fieldsToUnixTime(const uint16_t year,
+                                                 const uint8_t month,
+                                                 const uint8_t monthDay,
+                                                 const uint8_t hour,
+                                                 const uint8_t min,
+                                                 const uint8_t sec)
+{
+  // Check valid time, year, day and month with a single branch
+  if (IS_BIGGER(sec, TINY_SEC_MAX) | IS_BIGGER(min, TINY_MINUTE_MAX) |
+      IS_BIGGER(hour, TINY_HOUR_MAX) | IS_SMALLER(year, TINY_UNIX_YEAR_BEGIN) |
+      IS_NOT_IN_RANGE(monthDay, MONTH_DAY_OFFSET,
+                      tiny_getMonthDays(year, month))) {
     return ERROR_VALUE;
   }
 
-  const uint16_t unixYearDiff = tm->year - TINY_UNIX_YEAR_BEGIN;
-  const uint16_t leapYearCheck =
-      tm->year - FIRST_LEAP_YEAR_OFFSET; // Used to include last year, this year
-                                         // will be included in
-  uint16_t numberOfLeapYears =
-      (uint16_t)((unixYearDiff + FIRST_LEAP_YEAR_OFFSET) / LEAP_YEAR_FREQUENCY -
-                 (leapYearCheck - CENTURY_CORRECTION_OFFSET) /
-                     LEAP_YEAR_REMOVED +
-                 (leapYearCheck - FOUR_CENTURY_CORRECTION_OFFSET) /
-                     LEAP_YEAR_CORRECTION);
+  const tinyUnixType days = tiny_civilToDays(year, month, monthDay);
+  return days * TINY_ONE_DAY_IN_SEC + hour * TINY_ONE_HOUR_IN_SEC +
+         min * TINY_ONE_MIN_IN_SEC + sec;
+}
 
-  tinyUnixType days =
-      (tinyUnixType)unixYearDiff * TINY_ONE_YEAR_IN_DAYS + numberOfLeapYears;
+/**
+ * @brief Converts a time type to unix time without a NULL check.
+ *
+ * @param tm Base time type to convert to unix time
+ * @return tinyUnixType Unix time of the tm time and date or ERROR_VALUE in case
+ * of an invalid time or date
+ */
+static inline tinyUnixType tiny_toUnixTime(const tinyTimeType *tm)
+{
+  return tiny_fieldsToUnixTime(tm->year, tm->month, tm->monthDay, tm->hour,
+                               tm->min, tm->sec);
+}
 
-  for (uint8_t i = TINY_JAN; i < tm->month; i++) {
-    days += (tinyUnixType)tiny_getMonthDays(tm->year, i);
-  }
+/**
+ * @brief Converts the unix time to a time type without a NULL check.
+ *
+ * @param tm The reference to a tinyTimeType structure instance
+ * @param unixTime The unix time to convert
+ */
+static inline void tiny_toTimeType(tinyTimeType *tm,
+                                   const tinyUnixType unixTime)
+{
+  // Get base values
+  uint32_t secInDay;
+  const uint64_t days = tiny_divide(unixTime, DAY_DIVISOR, &secInDay);
+  // Set current daytime
+  tm->hour = (uint8_t)(secInDay / TINY_ONE_HOUR_IN_SEC);
+  tm->min = (uint8_t)((secInDay % TINY_ONE_HOUR_IN_SEC) / TINY_ONE_MIN_IN_SEC);
+  tm->sec = (uint8_t)(secInDay % TINY_ONE_MIN_IN_SEC);
+  // Get year, month, days and weak day in closed form
+  tiny_daysToCivil(tm, days);
+}
 
-  days += (tinyUnixType)tm->monthDay - MONTH_DAY_OFFSET;
-  return days * TINY_ONE_DAY_IN_SEC + tm->hour * TINY_ONE_HOUR_IN_SEC +
-         tm->min * TINY_ONE_MIN_IN_SEC + tm->sec;
+tinyUnixType tiny_getUnixTime(const tinyTimeType *tm)
+{
+  if (NULL == tm) {
+    return ERROR_VALUE;
+  }
+  return tiny_toUnixTime(tm);
 }
 
 void tiny_getTimeType(tinyTimeType *tm, const tinyUnixType unixTime)
@@ -101,77 +435,4247 @@ void tiny_getTimeType(tinyTimeType *tm, const tinyUnixType unixTime)
   if (NULL == tm) {
     return;
   }
-  // Get base values
-  uint64_t days = unixTime / TINY_ONE_DAY_IN_SEC + 1;
-  uint64_t secInDay = unixTime % TINY_ONE_DAY_IN_SEC;
-  // Set current daytime
+  tiny_toTimeType(tm, unixTime);
+}
+
+void tiny_initConverter(tinyConverterType *converter)
+{
+  if (NULL == converter) {
+    return;
+  }
+  // Start with the day of the unix epoch
+  converter->dayStart = 0;
+  tiny_toTimeType(&converter->day, 0);
+}
+
+void tiny_convertTimeType(tinyConverterType *converter,
+                          tinyTimeType *tm,
+                          const tinyUnixType unixTime)
+{
+  if (NULL == converter || NULL == tm) {
+    return;
+  }
+  tinyUnixType secSinceDayStart = unixTime - converter->dayStart;
+  if (IS_SMALLER(unixTime, converter->dayStart) ||
+      !IS_SMALLER(secSinceDayStart, 2 * (tinyUnixType)TINY_ONE_DAY_IN_SEC)) {
+    // Not the cached or the next day, convert the whole time
+    tiny_toTimeType(tm, unixTime);
+    converter->day = *tm;
+    converter->dayStart = unixTime -
+                          tm->hour * (tinyUnixType)TINY_ONE_HOUR_IN_SEC -
+                          tm->min * (tinyUnixType)TINY_ONE_MIN_IN_SEC - tm->sec;
+    return;
+  }
+  tinyTimeType *day = &converter->day;
+  if (!IS_SMALLER(secSinceDayStart, TINY_ONE_DAY_IN_SEC)) {
+    // Step one day forward
+    converter->dayStart += TINY_ONE_DAY_IN_SEC;
+    secSinceDayStart -= TINY_ONE_DAY_IN_SEC;
+    day->weakDay = (uint8_t)((day->weakDay + 1) % TINY_MAX_WEAKDAYS);
+    day->yearDay++;
+    if (IS_BIGGER(++day->monthDay, tiny_getMonthDays(day->year, day->month))) {
+      day->monthDay = MONTH_DAY_OFFSET;
+      if (IS_BIGGER(++day->month, TINY_DEC)) {
+        day->month = TINY_JAN;
+        day->yearDay = MONTH_DAY_OFFSET;
+        day->year++;
+      }
+    }
+  }
+  // Only the day time changes within the cached day
+  const uint32_t secInDay = (uint32_t)secSinceDayStart;
+  *tm = *day;
   tm->hour = (uint8_t)(secInDay / TINY_ONE_HOUR_IN_SEC);
   tm->min = (uint8_t)((secInDay % TINY_ONE_HOUR_IN_SEC) / TINY_ONE_MIN_IN_SEC);
   tm->sec = (uint8_t)(secInDay % TINY_ONE_MIN_IN_SEC);
-  // Calculate Weekday, First day was a thursday (1.1.1970)
-  tm->weakDay = (uint8_t)((days + TINY_WED) % TINY_MAX_WEAKDAYS);
-  // Get current year, move throw all years
-  uint16_t year = TINY_UNIX_YEAR_BEGIN;
-  while (1) {
-    uint64_t daysInYear = TINY_ONE_YEAR_IN_DAYS + tiny_isLeapYear(year);
-    if (days < daysInYear) {
-      break;
+}
+
+#ifdef TINY_TIME_X86_SIMD
+#define SIMD_UNIX_LIMIT_MASK (~(((tinyUnixType)1 << 38) - 1)) ///< Until 10680
+#define SIMD_DAY_SHIFT (7U) ///< Power of two part of the day in seconds
+/*
+ * Reciprocal multipliers and shifts of the SIMD divisions. The shift is at
+ * least 32, they are exact for the value ranges below the unix time limit and
+ * for all uint16_t years.
+ */
+#define SIMD_DAY_MAGIC (0xC22E4507U) ///< Reciprocal of 675, day without 2^7
+#define SIMD_DAY_MAGIC_SHIFT (41)     ///< Reciprocal shift of 675
+#define SIMD_HOUR_DIVISOR 0x00123457U, 32U   ///< Divides by 3600
+#define SIMD_MIN_DIVISOR 0x04444445U, 32U    ///< Divides by 60
+#define SIMD_ERA_DIVISOR 0x00396B07U, 39U    ///< Divides by 146097
+#define SIMD_4Y_DIVISOR 0x002CE33FU, 32U     ///< Divides by 1460
+#define SIMD_100Y_DIVISOR 0x000396B3U, 33U   ///< Divides by 36524
+#define SIMD_400Y_DIVISOR 0x000396B3U, 35U   ///< Divides by 146096
+#define SIMD_YEAR_DIVISOR 0x00B38CFAU, 32U   ///< Divides by 365
+#define SIMD_MONTH_DIVISOR 0x01AC5702U, 32U  ///< Divides by 153
+#define SIMD_5_DIVISOR 0x33333334U, 32U      ///< Divides by 5
+#define SIMD_100_DIVISOR 0x028F5C29U, 32U    ///< Divides by 100
+#define SIMD_400_DIVISOR 0x00A3D70BU, 32U    ///< Divides by 400
+#define SIMD_WEAK_DIVISOR 0x24924925U, 32U   ///< Divides by 7
+#define SIMD_3_DIVISOR 0x55555556U, 32U      ///< Divides by 3
+#define SIMD_BYTE_BITS (8)                   ///< Bits of a packed field
+#define SIMD_HALF_BITS (16)                  ///< Bits of a packed 16 bit field
+#define SIMD_BYTE_MASK (0xFF)                ///< Mask of a packed 8 bit field
+#define SIMD_TIME_WORDS (3U) ///< 32 bit words of a tinyTimeType
+
+_Static_assert(sizeof(tinyTimeType) == SIMD_TIME_WORDS * sizeof(uint32_t) &&
+                   offsetof(tinyTimeType, monthDay) == 3 &&
+                   offsetof(tinyTimeType, month) == 4 &&
+                   offsetof(tinyTimeType, year) == 6 &&
+                   offsetof(tinyTimeType, weakDay) == 8 &&
+                   offsetof(tinyTimeType, yearDay) == 10,
+               "SIMD kernels expect the x86-64 tinyTimeType layout");
+
+/**
+ * @brief Divides eight 32 bit lanes by a constant with its reciprocal.
+ *
+ * @param x The lanes to divide
+ * @param magic The reciprocal multiplier
+ * @param shift The reciprocal shift, at least 32
+ * @return __m256i The quotients of the lanes
+ */
+__attribute__((target("avx2"))) static inline __m256i
+tiny_divideAvx2(const __m256i x, const uint32_t magic, const uint8_t shift)
+{
+  const __m256i multiplier = _mm256_set1_epi32((int)magic);
+  const __m256i even = _mm256_srli_epi64(_mm256_mul_epu32(x, multiplier), 32);
+  const __m256i odd =
+      _mm256_mul_epu32(_mm256_srli_epi64(x, 32), multiplier);
+  return _mm256_srli_epi32(_mm256_blend_epi32(even, odd, 0xAA), shift - 32);
+}
+
+/**
+ * @brief Packs the low 32 bits of two vectors with four 64 bit lanes.
+ *
+ * @param low The lanes 0 to 3
+ * @param high The lanes 4 to 7
+ * @return __m256i The eight packed 32 bit lanes
+ */
+__attribute__((target("avx2"))) static inline __m256i
+tiny_packLowAvx2(const __m256i low, const __m256i high)
+{
+  const __m256i order = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+  return _mm256_permute2x128_si256(_mm256_permutevar8x32_epi32(low, order),
+                                   _mm256_permutevar8x32_epi32(high, order),
+                                   0x20);
+}
+
+/**
+ * @brief Converts unix times to time types with AVX2, eight at a time.
+ *
+ * Same calculation as tiny_daysToCivil on 32 bit lanes. Blocks with a unix
+ * time beyond the SIMD limit are converted with the scalar kernel.
+ *
+ * @param tm Array of count tinyTimeType structures to store the results
+ * @param unixTimes Array of count unix times to convert
+ * @param count The number of elements to convert
+ * @return size_t The number of converted elements, a multiple of eight
+ */
+__attribute__((target("avx2"))) static size_t
+tiny_getTimeTypeAvx2(tinyTimeType *tm,
+                     const tinyUnixType *unixTimes,
+                     const size_t count)
+{
+#define AVX2_LANES (8U)
+  const __m256i limitMask = _mm256_set1_epi64x((long long)SIMD_UNIX_LIMIT_MASK);
+  const __m256i one = _mm256_set1_epi32(1);
+  // Element and word of the tinyTimeType array for each stored 32 bit word
+  __m256i element[SIMD_TIME_WORDS];
+  __m256i wordMask1[SIMD_TIME_WORDS];
+  __m256i wordMask2[SIMD_TIME_WORDS];
+  for (uint8_t k = 0; k < SIMD_TIME_WORDS; k++) {
+    const __m256i index = _mm256_add_epi32(
+        _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7),
+        _mm256_set1_epi32(k * (int)AVX2_LANES));
+    element[k] = tiny_divideAvx2(index, SIMD_3_DIVISOR);
+    const __m256i word = _mm256_sub_epi32(
+        index, _mm256_mullo_epi32(element[k], _mm256_set1_epi32(3)));
+    wordMask1[k] = _mm256_cmpeq_epi32(word, one);
+    wordMask2[k] = _mm256_cmpeq_epi32(word, _mm256_set1_epi32(2));
+  }
+
+  size_t i = 0;
+  for (; i + AVX2_LANES <= count; i += AVX2_LANES) {
+    const __m256i unixLow = _mm256_loadu_si256((const __m256i *)&unixTimes[i]);
+    const __m256i unixHigh =
+        _mm256_loadu_si256((const __m256i *)&unixTimes[i + AVX2_LANES / 2]);
+    if (!_mm256_testz_si256(_mm256_or_si256(unixLow, unixHigh), limitMask)) {
+      for (size_t j = i; j < i + AVX2_LANES; j++) {
+        tiny_toTimeType(&tm[j], unixTimes[j]);
+      }
+      continue;
+    }
+    // Days of the unix time with 64 bit products
+    const __m256i dayMagic = _mm256_set1_epi32((int)SIMD_DAY_MAGIC);
+    const __m256i days = tiny_packLowAvx2(
+        _mm256_srli_epi64(
+            _mm256_mul_epu32(_mm256_srli_epi64(unixLow, SIMD_DAY_SHIFT),
+                             dayMagic),
+            SIMD_DAY_MAGIC_SHIFT),
+        _mm256_srli_epi64(
+            _mm256_mul_epu32(_mm256_srli_epi64(unixHigh, SIMD_DAY_SHIFT),
+                             dayMagic),
+            SIMD_DAY_MAGIC_SHIFT));
+    const __m256i secInDay = _mm256_sub_epi32(
+        tiny_packLowAvx2(unixLow, unixHigh),
+        _mm256_mullo_epi32(days, _mm256_set1_epi32(TINY_ONE_DAY_IN_SEC)));
+    // Day time
+    const __m256i hour = tiny_divideAvx2(secInDay, SIMD_HOUR_DIVISOR);
+    const __m256i secInHour = _mm256_sub_epi32(
+        secInDay,
+        _mm256_mullo_epi32(hour, _mm256_set1_epi32(TINY_ONE_HOUR_IN_SEC)));
+    const __m256i min = tiny_divideAvx2(secInHour, SIMD_MIN_DIVISOR);
+    const __m256i sec = _mm256_sub_epi32(
+        secInHour,
+        _mm256_mullo_epi32(min, _mm256_set1_epi32(TINY_ONE_MIN_IN_SEC)));
+    // Era and the day in the era
+    const __m256i shiftedDays =
+        _mm256_add_epi32(days, _mm256_set1_epi32(ERA_EPOCH_OFFSET_DAYS));
+    const __m256i era = tiny_divideAvx2(shiftedDays, SIMD_ERA_DIVISOR);
+    const __m256i eraDay = _mm256_sub_epi32(
+        shiftedDays, _mm256_mullo_epi32(era, _mm256_set1_epi32(ERA_DAYS)));
+    // Year of the era and the day of the march based year
+    const __m256i eraYear = tiny_divideAvx2(
+        _mm256_sub_epi32(
+            _mm256_add_epi32(
+                _mm256_sub_epi32(eraDay,
+                                 tiny_divideAvx2(eraDay, SIMD_4Y_DIVISOR)),
+                tiny_divideAvx2(eraDay, SIMD_100Y_DIVISOR)),
+            tiny_divideAvx2(eraDay, SIMD_400Y_DIVISOR)),
+        SIMD_YEAR_DIVISOR);
+    const __m256i shiftedYearDay = _mm256_sub_epi32(
+        eraDay,
+        _mm256_sub_epi32(
+            _mm256_add_epi32(
+                _mm256_mullo_epi32(eraYear,
+                                   _mm256_set1_epi32(TINY_ONE_YEAR_IN_DAYS)),
+                _mm256_srli_epi32(eraYear, 2)),
+            tiny_divideAvx2(eraYear, SIMD_100_DIVISOR)));
+    const __m256i shiftedMonth = tiny_divideAvx2(
+        _mm256_add_epi32(
+            _mm256_mullo_epi32(shiftedYearDay,
+                               _mm256_set1_epi32(SHIFTED_MONTH_DAYS_DIVISOR)),
+            _mm256_set1_epi32(SHIFTED_MONTH_ROUNDING)),
+        SIMD_MONTH_DIVISOR);
+    const __m256i isJanOrFeb = _mm256_cmpgt_epi32(
+        shiftedMonth, _mm256_set1_epi32(SHIFTED_MONTHS_TO_JAN - 1));
+    // Civil year and its leap day
+    const __m256i year = _mm256_sub_epi32(
+        _mm256_add_epi32(
+            _mm256_mullo_epi32(era, _mm256_set1_epi32(LEAP_YEAR_CORRECTION)),
+            eraYear),
+        isJanOrFeb);
+    const __m256i century = tiny_divideAvx2(year, SIMD_100_DIVISOR);
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i three = _mm256_set1_epi32(3);
+    const __m256i notCentury = _mm256_xor_si256(
+        _mm256_cmpeq_epi32(
+            year, _mm256_mullo_epi32(century,
+                                     _mm256_set1_epi32(LEAP_YEAR_REMOVED))),
+        _mm256_set1_epi32(-1));
+    const __m256i leapDay = _mm256_and_si256(
+        _mm256_and_si256(
+            _mm256_cmpeq_epi32(_mm256_and_si256(year, three), zero),
+            _mm256_or_si256(notCentury,
+                            _mm256_cmpeq_epi32(
+                                _mm256_and_si256(century, three), zero))),
+        one);
+    // Weak day, month day, month and year day
+    const __m256i weakBase =
+        _mm256_add_epi32(eraDay, _mm256_set1_epi32(ERA_DAY_TO_WEAK_DAY));
+    const __m256i weakDay = _mm256_sub_epi32(
+        weakBase,
+        _mm256_mullo_epi32(tiny_divideAvx2(weakBase, SIMD_WEAK_DIVISOR),
+                           _mm256_set1_epi32(TINY_MAX_WEAKDAYS)));
+    const __m256i monthDay = _mm256_add_epi32(
+        _mm256_sub_epi32(
+            shiftedYearDay,
+            tiny_divideAvx2(
+                _mm256_add_epi32(
+                    _mm256_mullo_epi32(shiftedMonth,
+                                       _mm256_set1_epi32(SHIFTED_MONTH_DAYS)),
+                    _mm256_set1_epi32(SHIFTED_MONTH_ROUNDING)),
+                SIMD_5_DIVISOR)),
+        one);
+    const __m256i month = _mm256_sub_epi32(
+        _mm256_add_epi32(shiftedMonth, _mm256_set1_epi32(TINY_MAR)),
+        _mm256_and_si256(isJanOrFeb,
+                         _mm256_set1_epi32(TINY_MAX_MONTHS - TINY_JAN)));
+    const __m256i yearDay = _mm256_sub_epi32(
+        _mm256_add_epi32(
+            shiftedYearDay,
+            _mm256_add_epi32(
+                leapDay,
+                _mm256_set1_epi32(JAN_AND_FEB_DAYS + MONTH_DAY_OFFSET))),
+        _mm256_and_si256(
+            isJanOrFeb,
+            _mm256_add_epi32(leapDay,
+                             _mm256_set1_epi32(TINY_ONE_YEAR_IN_DAYS))));
+    // Pack the fields into the three words of a tinyTimeType
+    const __m256i words[SIMD_TIME_WORDS] = {
+        _mm256_or_si256(
+            _mm256_or_si256(sec, _mm256_slli_epi32(min, SIMD_BYTE_BITS)),
+            _mm256_or_si256(_mm256_slli_epi32(hour, 2 * SIMD_BYTE_BITS),
+                            _mm256_slli_epi32(monthDay, 3 * SIMD_BYTE_BITS))),
+        _mm256_or_si256(month, _mm256_slli_epi32(year, SIMD_HALF_BITS)),
+        _mm256_or_si256(weakDay, _mm256_slli_epi32(yearDay, SIMD_HALF_BITS))};
+    // Transpose the words into the eight structures and store them
+    for (uint8_t k = 0; k < SIMD_TIME_WORDS; k++) {
+      __m256i out = _mm256_permutevar8x32_epi32(words[0], element[k]);
+      out = _mm256_blendv_epi8(
+          out, _mm256_permutevar8x32_epi32(words[1], element[k]), wordMask1[k]);
+      out = _mm256_blendv_epi8(
+          out, _mm256_permutevar8x32_epi32(words[2], element[k]), wordMask2[k]);
+      _mm256_storeu_si256((__m256i *)&tm[i] + k, out);
     }
-    days -= daysInYear; // Decrement the current year days
-    year++;             // Increment the year
   }
-  // Set year and the current yearDay as rest of current year
-  tm->year = year;
-  tm->yearDay = (uint16_t)days;
-  // Get month and day
-  for (uint8_t month = TINY_JAN; month < TINY_MAX_MONTHS; month++) {
-    uint16_t daysInMonth = tiny_getMonthDays(year, month);
-    if (days <= daysInMonth) {
-      tm->month = month;
-      tm->monthDay = (uint8_t)days; // Starting at 1
-      return;
+  return i;
+}
+
+/**
+ * @brief Divides sixteen 32 bit lanes by a constant with its reciprocal.
+ *
+ * @param x The lanes to divide
+ * @param magic The reciprocal multiplier
+ * @param shift The reciprocal shift, at least 32
+ * @return __m512i The quotients of the lanes
+ */
+__attribute__((target("avx512f"))) static inline __m512i
+tiny_divideAvx512(const __m512i x, const uint32_t magic, const uint8_t shift)
+{
+  const __m512i multiplier = _mm512_set1_epi32((int)magic);
+  const __m512i even = _mm512_srli_epi64(_mm512_mul_epu32(x, multiplier), 32);
+  const __m512i odd =
+      _mm512_mul_epu32(_mm512_srli_epi64(x, 32), multiplier);
+  return _mm512_srli_epi32(_mm512_mask_blend_epi32(0xAAAA, even, odd),
+                           shift - 32);
+}
+
+/**
+ * @brief Converts unix times to time types with AVX-512, sixteen at a time.
+ *
+ * Same calculation as tiny_getTimeTypeAvx2 with mask registers.
+ *
+ * @param tm Array of count tinyTimeType structures to store the results
+ * @param unixTimes Array of count unix times to convert
+ * @param count The number of elements to convert
+ * @return size_t The number of converted elements, a multiple of sixteen
+ */
+__attribute__((target("avx512f"))) static size_t
+tiny_getTimeTypeAvx512(tinyTimeType *tm,
+                       const tinyUnixType *unixTimes,
+                       const size_t count)
+{
+#define AVX512_LANES (16U)
+  const __m512i limitMask = _mm512_set1_epi64((long long)SIMD_UNIX_LIMIT_MASK);
+  const __m512i one = _mm512_set1_epi32(1);
+  const __m512i three = _mm512_set1_epi32(3);
+  // Element and word of the tinyTimeType array for each stored 32 bit word
+  __m512i element[SIMD_TIME_WORDS];
+  __mmask16 wordMask1[SIMD_TIME_WORDS];
+  __mmask16 wordMask2[SIMD_TIME_WORDS];
+  for (uint8_t k = 0; k < SIMD_TIME_WORDS; k++) {
+    const __m512i index = _mm512_add_epi32(
+        _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15),
+        _mm512_set1_epi32(k * (int)AVX512_LANES));
+    element[k] = tiny_divideAvx512(index, SIMD_3_DIVISOR);
+    const __m512i word =
+        _mm512_sub_epi32(index, _mm512_mullo_epi32(element[k], three));
+    wordMask1[k] = _mm512_cmpeq_epi32_mask(word, one);
+    wordMask2[k] = _mm512_cmpeq_epi32_mask(word, _mm512_set1_epi32(2));
+  }
+
+  size_t i = 0;
+  for (; i + AVX512_LANES <= count; i += AVX512_LANES) {
+    const __m512i unixLow = _mm512_loadu_si512(&unixTimes[i]);
+    const __m512i unixHigh = _mm512_loadu_si512(&unixTimes[i + AVX512_LANES / 2]);
+    if (_mm512_test_epi64_mask(_mm512_or_si512(unixLow, unixHigh), limitMask)) {
+      for (size_t j = i; j < i + AVX512_LANES; j++) {
+        tiny_toTimeType(&tm[j], unixTimes[j]);
+      }
+      continue;
+    }
+    // Days of the unix time with 64 bit products
+    const __m512i dayMagic = _mm512_set1_epi32((int)SIMD_DAY_MAGIC);
+    const __m512i days = _mm512_inserti64x4(
+        _mm512_castsi256_si512(_mm512_cvtepi64_epi32(_mm512_srli_epi64(
+            _mm512_mul_epu32(_mm512_srli_epi64(unixLow, SIMD_DAY_SHIFT),
+                             dayMagic),
+            SIMD_DAY_MAGIC_SHIFT))),
+        _mm512_cvtepi64_epi32(_mm512_srli_epi64(
+            _mm512_mul_epu32(_mm512_srli_epi64(unixHigh, SIMD_DAY_SHIFT),
+                             dayMagic),
+            SIMD_DAY_MAGIC_SHIFT)),
+        1);
+    const __m512i unixDays = _mm512_inserti64x4(
+        _mm512_castsi256_si512(_mm512_cvtepi64_epi32(unixLow)),
+        _mm512_cvtepi64_epi32(unixHigh), 1);
+    const __m512i secInDay = _mm512_sub_epi32(
+        unixDays,
+        _mm512_mullo_epi32(days, _mm512_set1_epi32(TINY_ONE_DAY_IN_SEC)));
+    // Day time
+    const __m512i hour = tiny_divideAvx512(secInDay, SIMD_HOUR_DIVISOR);
+    const __m512i secInHour = _mm512_sub_epi32(
+        secInDay,
+        _mm512_mullo_epi32(hour, _mm512_set1_epi32(TINY_ONE_HOUR_IN_SEC)));
+    const __m512i min = tiny_divideAvx512(secInHour, SIMD_MIN_DIVISOR);
+    const __m512i sec = _mm512_sub_epi32(
+        secInHour,
+        _mm512_mullo_epi32(min, _mm512_set1_epi32(TINY_ONE_MIN_IN_SEC)));
+    // Era and the day in the era
+    const __m512i shiftedDays =
+        _mm512_add_epi32(days, _mm512_set1_epi32(ERA_EPOCH_OFFSET_DAYS));
+    const __m512i era = tiny_divideAvx512(shiftedDays, SIMD_ERA_DIVISOR);
+    const __m512i eraDay = _mm512_sub_epi32(
+        shiftedDays, _mm512_mullo_epi32(era, _mm512_set1_epi32(ERA_DAYS)));
+    // Year of the era and the day of the march based year
+    const __m512i eraYear = tiny_divideAvx512(
+        _mm512_sub_epi32(
+            _mm512_add_epi32(
+                _mm512_sub_epi32(eraDay,
+                                 tiny_divideAvx512(eraDay, SIMD_4Y_DIVISOR)),
+                tiny_divideAvx512(eraDay, SIMD_100Y_DIVISOR)),
+            tiny_divideAvx512(eraDay, SIMD_400Y_DIVISOR)),
+        SIMD_YEAR_DIVISOR);
+    const __m512i shiftedYearDay = _mm512_sub_epi32(
+        eraDay,
+        _mm512_sub_epi32(
+            _mm512_add_epi32(
+                _mm512_mullo_epi32(eraYear,
+                                   _mm512_set1_epi32(TINY_ONE_YEAR_IN_DAYS)),
+                _mm512_srli_epi32(eraYear, 2)),
+            tiny_divideAvx512(eraYear, SIMD_100_DIVISOR)));
+    const __m512i shiftedMonth = tiny_divideAvx512(
+        _mm512_add_epi32(
+            _mm512_mullo_epi32(shiftedYearDay,
+                               _mm512_set1_epi32(SHIFTED_MONTH_DAYS_DIVISOR)),
+            _mm512_set1_epi32(SHIFTED_MONTH_ROUNDING)),
+        SIMD_MONTH_DIVISOR);
+    const __mmask16 isJanOrFeb = _mm512_cmpgt_epu32_mask(
+        shiftedMonth, _mm512_set1_epi32(SHIFTED_MONTHS_TO_JAN - 1));
+    // Civil year and its leap day
+    const __m512i eraYearBase = _mm512_add_epi32(
+        _mm512_mullo_epi32(era, _mm512_set1_epi32(LEAP_YEAR_CORRECTION)),
+        eraYear);
+    const __m512i year =
+        _mm512_mask_add_epi32(eraYearBase, isJanOrFeb, eraYearBase, one);
+    const __m512i century = tiny_divideAvx512(year, SIMD_100_DIVISOR);
+    const __mmask16 isLeapYear =
+        _mm512_testn_epi32_mask(year, three) &
+        (_mm512_cmpneq_epi32_mask(
+             year, _mm512_mullo_epi32(century,
+                                      _mm512_set1_epi32(LEAP_YEAR_REMOVED))) |
+         _mm512_testn_epi32_mask(century, three));
+    const __m512i leapDay = _mm512_maskz_mov_epi32(isLeapYear, one);
+    // Weak day, month day, month and year day
+    const __m512i weakBase =
+        _mm512_add_epi32(eraDay, _mm512_set1_epi32(ERA_DAY_TO_WEAK_DAY));
+    const __m512i weakDay = _mm512_sub_epi32(
+        weakBase,
+        _mm512_mullo_epi32(tiny_divideAvx512(weakBase, SIMD_WEAK_DIVISOR),
+                           _mm512_set1_epi32(TINY_MAX_WEAKDAYS)));
+    const __m512i monthDay = _mm512_add_epi32(
+        _mm512_sub_epi32(
+            shiftedYearDay,
+            tiny_divideAvx512(
+                _mm512_add_epi32(
+                    _mm512_mullo_epi32(shiftedMonth,
+                                       _mm512_set1_epi32(SHIFTED_MONTH_DAYS)),
+                    _mm512_set1_epi32(SHIFTED_MONTH_ROUNDING)),
+                SIMD_5_DIVISOR)),
+        one);
+    const __m512i monthBase =
+        _mm512_add_epi32(shiftedMonth, _mm512_set1_epi32(TINY_MAR));
+    const __m512i month = _mm512_mask_sub_epi32(
+        monthBase, isJanOrFeb, monthBase,
+        _mm512_set1_epi32(TINY_MAX_MONTHS - TINY_JAN));
+    const __m512i yearDayBase = _mm512_add_epi32(
+        shiftedYearDay,
+        _mm512_add_epi32(leapDay,
+                         _mm512_set1_epi32(JAN_AND_FEB_DAYS + MONTH_DAY_OFFSET)));
+    const __m512i yearDay = _mm512_mask_sub_epi32(
+        yearDayBase, isJanOrFeb, yearDayBase,
+        _mm512_add_epi32(leapDay, _mm512_set1_epi32(TINY_ONE_YEAR_IN_DAYS)));
+    // Pack the fields into the three words of a tinyTimeType
+    const __m512i words[SIMD_TIME_WORDS] = {
+        _mm512_or_si512(
+            _mm512_or_si512(sec, _mm512_slli_epi32(min, SIMD_BYTE_BITS)),
+            _mm512_or_si512(_mm512_slli_epi32(hour, 2 * SIMD_BYTE_BITS),
+                            _mm512_slli_epi32(monthDay, 3 * SIMD_BYTE_BITS))),
+        _mm512_or_si512(month, _mm512_slli_epi32(year, SIMD_HALF_BITS)),
+        _mm512_or_si512(weakDay, _mm512_slli_epi32(yearDay, SIMD_HALF_BITS))};
+    // Transpose the words into the sixteen structures and store them
+    for (uint8_t k = 0; k < SIMD_TIME_WORDS; k++) {
+      __m512i out = _mm512_permutexvar_epi32(element[k], words[0]);
+      out = _mm512_mask_permutexvar_epi32(out, wordMask1[k], element[k],
+                                          words[1]);
+      out = _mm512_mask_permutexvar_epi32(out, wordMask2[k], element[k],
+                                          words[2]);
+      _mm512_storeu_si512((__m512i *)&tm[i] + k, out);
     }
-    days -= daysInMonth; // Decrement current month
   }
+  return i;
 }
 
-const char *tiny_getFormat(const tinyTimeType *tm)
+/**
+ * @brief Divides four 32 bit lanes by a constant with its reciprocal.
+ *
+ * @param x The lanes to divide
+ * @param magic The reciprocal multiplier
+ * @param shift The reciprocal shift, at least 32
+ * @return __m128i The quotients of the lanes
+ */
+__attribute__((target("sse4.1"))) static inline __m128i
+tiny_divideSse41(const __m128i x, const uint32_t magic, const uint8_t shift)
 {
-  if (NULL == tm) {
-    return NULL;
+  const __m128i multiplier = _mm_set1_epi32((int)magic);
+  const __m128i even = _mm_srli_epi64(_mm_mul_epu32(x, multiplier), 32);
+  const __m128i odd = _mm_mul_epu32(_mm_srli_epi64(x, 32), multiplier);
+  return _mm_srli_epi32(_mm_blend_epi16(even, odd, 0xCC), shift - 32);
+}
+
+/**
+ * @brief Converts four lanes of time and date fields to unix time with SSE4.1.
+ *
+ * Same validation as tiny_fieldsToUnixTime, invalid lanes are set to
+ * ERROR_VALUE.
+ *
+ * @param year The years of the lanes
+ * @param month The months of the lanes
+ * @param monthDay The month days of the lanes
+ * @param hour The hours of the lanes
+ * @param min The minutes of the lanes
+ * @param sec The seconds of the lanes
+ * @param unixTimes Array to store the four unix times
+ * @return uint8_t The invalid lanes with bit i for lane i
+ */
+__attribute__((target("sse4.1"))) static inline uint8_t
+tiny_fieldsToUnixTimeSse41(const __m128i year,
+                           const __m128i month,
+                           const __m128i monthDay,
+                           const __m128i hour,
+                           const __m128i min,
+                           const __m128i sec,
+                           tinyUnixType *unixTimes)
+{
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i three = _mm_set1_epi32(3);
+  // Leap year and the days of the month
+  const __m128i century = tiny_divideSse41(year, SIMD_100_DIVISOR);
+  const __m128i isLeapYear = _mm_and_si128(
+      _mm_cmpeq_epi32(_mm_and_si128(year, three), zero),
+      _mm_or_si128(
+          _mm_xor_si128(
+              _mm_cmpeq_epi32(year,
+                              _mm_mullo_epi32(
+                                  century, _mm_set1_epi32(LEAP_YEAR_REMOVED))),
+              _mm_set1_epi32(-1)),
+          _mm_cmpeq_epi32(_mm_and_si128(century, three), zero)));
+  const __m128i monthDays = _mm_blendv_epi8(
+      _mm_add_epi32(_mm_set1_epi32(MONTH_BASE_DAYS),
+                    _mm_and_si128(_mm_add_epi32(month, _mm_srli_epi32(month, 3)),
+                                  _mm_set1_epi32(1))),
+      _mm_sub_epi32(_mm_set1_epi32(FEB_DAYS), isLeapYear),
+      _mm_cmpeq_epi32(month, _mm_set1_epi32(TINY_FEB)));
+  // Check valid time, year, day and month
+  const __m128i invalid = _mm_or_si128(
+      _mm_or_si128(
+          _mm_or_si128(_mm_cmpgt_epi32(sec, _mm_set1_epi32(TINY_SEC_MAX)),
+                       _mm_cmpgt_epi32(min, _mm_set1_epi32(TINY_MINUTE_MAX))),
+          _mm_or_si128(
+              _mm_cmpgt_epi32(hour, _mm_set1_epi32(TINY_HOUR_MAX)),
+              _mm_cmpgt_epi32(_mm_set1_epi32(TINY_UNIX_YEAR_BEGIN), year))),
+      _mm_or_si128(
+          _mm_or_si128(_mm_cmpeq_epi32(month, zero),
+                       _mm_cmpgt_epi32(month, _mm_set1_epi32(TINY_DEC))),
+          _mm_or_si128(_mm_cmpeq_epi32(monthDay, zero),
+                       _mm_cmpgt_epi32(monthDay, monthDays))));
+  // Days since the epoch with a march based year
+  const __m128i isJanOrFeb = _mm_cmpgt_epi32(_mm_set1_epi32(TINY_MAR), month);
+  const __m128i shiftedYear = _mm_add_epi32(year, isJanOrFeb);
+  const __m128i era = tiny_divideSse41(shiftedYear, SIMD_400_DIVISOR);
+  const __m128i eraYear = _mm_sub_epi32(
+      shiftedYear, _mm_mullo_epi32(era, _mm_set1_epi32(LEAP_YEAR_CORRECTION)));
+  const __m128i shiftedMonth = _mm_add_epi32(
+      _mm_sub_epi32(month, _mm_set1_epi32(TINY_MAR)),
+      _mm_and_si128(isJanOrFeb, _mm_set1_epi32(TINY_MAX_MONTHS - TINY_JAN)));
+  const __m128i shiftedYearDay = _mm_add_epi32(
+      tiny_divideSse41(
+          _mm_add_epi32(
+              _mm_mullo_epi32(shiftedMonth, _mm_set1_epi32(SHIFTED_MONTH_DAYS)),
+              _mm_set1_epi32(SHIFTED_MONTH_ROUNDING)),
+          SIMD_5_DIVISOR),
+      _mm_sub_epi32(monthDay, _mm_set1_epi32(MONTH_DAY_OFFSET)));
+  const __m128i eraDay = _mm_add_epi32(
+      _mm_sub_epi32(
+          _mm_add_epi32(
+              _mm_mullo_epi32(eraYear, _mm_set1_epi32(TINY_ONE_YEAR_IN_DAYS)),
+              _mm_srli_epi32(eraYear, 2)),
+          tiny_divideSse41(eraYear, SIMD_100_DIVISOR)),
+      shiftedYearDay);
+  const __m128i days = _mm_sub_epi32(
+      _mm_add_epi32(_mm_mullo_epi32(era, _mm_set1_epi32(ERA_DAYS)), eraDay),
+      _mm_set1_epi32(ERA_EPOCH_OFFSET_DAYS));
+  const __m128i secInDay = _mm_add_epi32(
+      _mm_add_epi32(
+          _mm_mullo_epi32(hour, _mm_set1_epi32(TINY_ONE_HOUR_IN_SEC)),
+          _mm_mullo_epi32(min, _mm_set1_epi32(TINY_ONE_MIN_IN_SEC))),
+      sec);
+  // Widen to 64 bit unix times, invalid lanes get all bits set
+  const __m128i daySeconds = _mm_set1_epi64x(TINY_ONE_DAY_IN_SEC);
+  for (uint8_t half = 0; half < 2; half++) {
+    const uint8_t offset = (uint8_t)(half * 2);
+    const __m128i halfDays = _mm_cvtepu32_epi64(
+        half ? _mm_srli_si128(days, 8) : days);
+    const __m128i halfSeconds = _mm_cvtepu32_epi64(
+        half ? _mm_srli_si128(secInDay, 8) : secInDay);
+    const __m128i halfInvalid = _mm_cvtepi32_epi64(
+        half ? _mm_srli_si128(invalid, 8) : invalid);
+    _mm_storeu_si128(
+        (__m128i *)&unixTimes[offset],
+        _mm_or_si128(_mm_add_epi64(_mm_mul_epu32(halfDays, daySeconds),
+                                   halfSeconds),
+                     halfInvalid));
   }
+  return (uint8_t)_mm_movemask_ps(_mm_castsi128_ps(invalid));
+}
 
-#define BUFFER_SIZE (32)
-  static char formatBuffer[BUFFER_SIZE];
-  const char *weekDays[TINY_MAX_WEAKDAYS] = {
-      [TINY_SUN] = "Sun", [TINY_MON] = "Mon", [TINY_TUE] = "Tue",
-      [TINY_WED] = "Wed", [TINY_THU] = "Thu", [TINY_FRI] = "Fri",
-      [TINY_SAT] = "Sat"};
-
-  const char *months[TINY_MAX_MONTHS - TINY_JAN] = {
-      [TINY_JAN - TINY_JAN] = "Jan", [TINY_FEB - TINY_JAN] = "Feb",
-      [TINY_MAR - TINY_JAN] = "Mar", [TINY_APR - TINY_JAN] = "Apr",
-      [TINY_MAY - TINY_JAN] = "May", [TINY_JUN - TINY_JAN] = "Jun",
-      [TINY_JUL - TINY_JAN] = "Jul", [TINY_AUG - TINY_JAN] = "Aug",
-      [TINY_SEP - TINY_JAN] = "Sep", [TINY_OCT - TINY_JAN] = "Oct",
-      [TINY_NOV - TINY_JAN] = "Nov", [TINY_DEC - TINY_JAN] = "Dec"};
-  if (IS_BIGGER(tm->weakDay, TINY_SAT)) {
-    snprintf(formatBuffer, BUFFER_SIZE, "Day %3d not in range", tm->weakDay);
-  } else if (IS_NOT_IN_RANGE(tm->month, TINY_JAN, TINY_DEC)) {
-    snprintf(formatBuffer, BUFFER_SIZE, "Month %3d not in range", tm->month);
-  } else {
-    snprintf(formatBuffer, BUFFER_SIZE, "%s %2d %s %4d %.2d:%.2d:%.2d",
-             weekDays[tm->weakDay], tm->monthDay, months[tm->month - TINY_JAN],
-             tm->year, tm->hour, tm->min, tm->sec);
+/**
+ * @brief Converts time columns to unix time with SSE4.1, eight at a time.
+ *
+ * @param unixTimes Array of count unix times to store the results
+ * @param columns The time and date columns to convert
+ * @param count The number of elements to convert
+ * @param invalidMap Bitmap to mark the invalid elements or NULL
+ * @param invalidCount Reference to add the number of invalid elements
+ * @return size_t The number of converted elements, a multiple of eight
+ */
+__attribute__((target("sse4.1,popcnt"))) static size_t
+tiny_getUnixTimeColumnsSse41(tinyUnixType *unixTimes,
+                             const tinyTimeColumnsType *columns,
+                             const size_t count,
+                             uint8_t *invalidMap,
+                             size_t *invalidCount)
+{
+#define SSE41_LANES (4U)
+#define SSE41_BLOCK (8U)
+  size_t i = 0;
+  for (; i + SSE41_BLOCK <= count; i += SSE41_BLOCK) {
+    const __m128i years = _mm_loadu_si128((const __m128i *)&columns->year[i]);
+    const __m128i months = _mm_loadl_epi64((const __m128i *)&columns->month[i]);
+    const __m128i monthDays =
+        _mm_loadl_epi64((const __m128i *)&columns->monthDay[i]);
+    const __m128i hours = _mm_loadl_epi64((const __m128i *)&columns->hour[i]);
+    const __m128i mins = _mm_loadl_epi64((const __m128i *)&columns->min[i]);
+    const __m128i secs = _mm_loadl_epi64((const __m128i *)&columns->sec[i]);
+    uint8_t invalidBits = 0;
+    for (uint8_t half = 0; half < 2; half++) {
+      const int shift = half * (int)SSE41_LANES;
+      invalidBits |= (uint8_t)(
+          tiny_fieldsToUnixTimeSse41(
+              _mm_cvtepu16_epi32(half ? _mm_srli_si128(years, 8) : years),
+              _mm_cvtepu8_epi32(half ? _mm_srli_si128(months, 4) : months),
+              _mm_cvtepu8_epi32(half ? _mm_srli_si128(monthDays, 4)
+                                     : monthDays),
+              _mm_cvtepu8_epi32(half ? _mm_srli_si128(hours, 4) : hours),
+              _mm_cvtepu8_epi32(half ? _mm_srli_si128(mins, 4) : mins),
+              _mm_cvtepu8_epi32(half ? _mm_srli_si128(secs, 4) : secs),
+              &unixTimes[i + (size_t)shift])
+          << shift);
+    }
+    if (invalidMap) {
+      invalidMap[i / INVALID_MAP_BITS] = invalidBits;
+    }
+    *invalidCount += (size_t)__builtin_popcount(invalidBits);
   }
-  return formatBuffer;
+  return i;
+}
+
+/**
+ * @brief Packs the low 32 bits of two vectors with two 64 bit lanes.
+ *
+ * @param low The lanes 0 and 1
+ * @param high The lanes 2 and 3
+ * @return __m128i The four packed 32 bit lanes
+ */
+__attribute__((target("sse4.1"))) static inline __m128i
+tiny_packLowSse41(const __m128i low, const __m128i high)
+{
+  return _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(low),
+                                         _mm_castsi128_ps(high),
+                                         _MM_SHUFFLE(2, 0, 2, 0)));
+}
+
+/**
+ * @brief Converts unix times to time types with SSE4.1, four at a time.
+ *
+ * Same calculation as tiny_getTimeTypeAvx2 on four lanes. Blocks with a unix
+ * time beyond the SIMD limit are converted with the scalar kernel.
+ *
+ * @param tm Array of count tinyTimeType structures to store the results
+ * @param unixTimes Array of count unix times to convert
+ * @param count The number of elements to convert
+ * @return size_t The number of converted elements, a multiple of four
+ */
+__attribute__((target("sse4.1"))) static size_t
+tiny_getTimeTypeSse41(tinyTimeType *tm,
+                      const tinyUnixType *unixTimes,
+                      const size_t count)
+{
+  const __m128i limitMask = _mm_set1_epi64x((long long)SIMD_UNIX_LIMIT_MASK);
+  const __m128i one = _mm_set1_epi32(1);
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i three = _mm_set1_epi32(3);
+  const __m128i dayMagic = _mm_set1_epi32((int)SIMD_DAY_MAGIC);
+  size_t i = 0;
+  for (; i + SSE41_LANES <= count; i += SSE41_LANES) {
+    const __m128i unixLow = _mm_loadu_si128((const __m128i *)&unixTimes[i]);
+    const __m128i unixHigh =
+        _mm_loadu_si128((const __m128i *)&unixTimes[i + SSE41_LANES / 2]);
+    if (!_mm_testz_si128(_mm_or_si128(unixLow, unixHigh), limitMask)) {
+      for (size_t j = i; j < i + SSE41_LANES; j++) {
+        tiny_toTimeType(&tm[j], unixTimes[j]);
+      }
+      continue;
+    }
+    // Days of the unix time with 64 bit products
+    const __m128i days = tiny_packLowSse41(
+        _mm_srli_epi64(
+            _mm_mul_epu32(_mm_srli_epi64(unixLow, SIMD_DAY_SHIFT), dayMagic),
+            SIMD_DAY_MAGIC_SHIFT),
+        _mm_srli_epi64(
+            _mm_mul_epu32(_mm_srli_epi64(unixHigh, SIMD_DAY_SHIFT), dayMagic),
+            SIMD_DAY_MAGIC_SHIFT));
+    const __m128i secInDay = _mm_sub_epi32(
+        tiny_packLowSse41(unixLow, unixHigh),
+        _mm_mullo_epi32(days, _mm_set1_epi32(TINY_ONE_DAY_IN_SEC)));
+    // Day time
+    const __m128i hour = tiny_divideSse41(secInDay, SIMD_HOUR_DIVISOR);
+    const __m128i secInHour = _mm_sub_epi32(
+        secInDay, _mm_mullo_epi32(hour, _mm_set1_epi32(TINY_ONE_HOUR_IN_SEC)));
+    const __m128i min = tiny_divideSse41(secInHour, SIMD_MIN_DIVISOR);
+    const __m128i sec = _mm_sub_epi32(
+        secInHour, _mm_mullo_epi32(min, _mm_set1_epi32(TINY_ONE_MIN_IN_SEC)));
+    // Era and the day in the era
+    const __m128i shiftedDays =
+        _mm_add_epi32(days, _mm_set1_epi32(ERA_EPOCH_OFFSET_DAYS));
+    const __m128i era = tiny_divideSse41(shiftedDays, SIMD_ERA_DIVISOR);
+    const __m128i eraDay = _mm_sub_epi32(
+        shiftedDays, _mm_mullo_epi32(era, _mm_set1_epi32(ERA_DAYS)));
+    // Year of the era and the day of the march based year
+    const __m128i eraYear = tiny_divideSse41(
+        _mm_sub_epi32(
+            _mm_add_epi32(
+                _mm_sub_epi32(eraDay, tiny_divideSse41(eraDay, SIMD_4Y_DIVISOR)),
+                tiny_divideSse41(eraDay, SIMD_100Y_DIVISOR)),
+            tiny_divideSse41(eraDay, SIMD_400Y_DIVISOR)),
+        SIMD_YEAR_DIVISOR);
+    const __m128i shiftedYearDay = _mm_sub_epi32(
+        eraDay,
+        _mm_sub_epi32(
+            _mm_add_epi32(
+                _mm_mullo_epi32(eraYear, _mm_set1_epi32(TINY_ONE_YEAR_IN_DAYS)),
+                _mm_srli_epi32(eraYear, 2)),
+            tiny_divideSse41(eraYear, SIMD_100_DIVISOR)));
+    const __m128i shiftedMonth = tiny_divideSse41(
+        _mm_add_epi32(_mm_mullo_epi32(shiftedYearDay,
+                                      _mm_set1_epi32(SHIFTED_MONTH_DAYS_DIVISOR)),
+                      _mm_set1_epi32(SHIFTED_MONTH_ROUNDING)),
+        SIMD_MONTH_DIVISOR);
+    const __m128i isJanOrFeb = _mm_cmpgt_epi32(
+        shiftedMonth, _mm_set1_epi32(SHIFTED_MONTHS_TO_JAN - 1));
+    // Civil year and its leap day
+    const __m128i year = _mm_sub_epi32(
+        _mm_add_epi32(
+            _mm_mullo_epi32(era, _mm_set1_epi32(LEAP_YEAR_CORRECTION)),
+            eraYear),
+        isJanOrFeb);
+    const __m128i century = tiny_divideSse41(year, SIMD_100_DIVISOR);
+    const __m128i notCentury = _mm_xor_si128(
+        _mm_cmpeq_epi32(
+            year, _mm_mullo_epi32(century, _mm_set1_epi32(LEAP_YEAR_REMOVED))),
+        _mm_set1_epi32(-1));
+    const __m128i leapDay = _mm_and_si128(
+        _mm_and_si128(
+            _mm_cmpeq_epi32(_mm_and_si128(year, three), zero),
+            _mm_or_si128(notCentury, _mm_cmpeq_epi32(
+                                         _mm_and_si128(century, three), zero))),
+        one);
+    // Weak day, month day, month and year day
+    const __m128i weakBase =
+        _mm_add_epi32(eraDay, _mm_set1_epi32(ERA_DAY_TO_WEAK_DAY));
+    const __m128i weakDay = _mm_sub_epi32(
+        weakBase,
+        _mm_mullo_epi32(tiny_divideSse41(weakBase, SIMD_WEAK_DIVISOR),
+                        _mm_set1_epi32(TINY_MAX_WEAKDAYS)));
+    const __m128i monthDay = _mm_add_epi32(
+        _mm_sub_epi32(
+            shiftedYearDay,
+            tiny_divideSse41(
+                _mm_add_epi32(_mm_mullo_epi32(shiftedMonth,
+                                              _mm_set1_epi32(SHIFTED_MONTH_DAYS)),
+                              _mm_set1_epi32(SHIFTED_MONTH_ROUNDING)),
+                SIMD_5_DIVISOR)),
+        one);
+    const __m128i month = _mm_sub_epi32(
+        _mm_add_epi32(shiftedMonth, _mm_set1_epi32(TINY_MAR)),
+        _mm_and_si128(isJanOrFeb, _mm_set1_epi32(TINY_MAX_MONTHS - TINY_JAN)));
+    const __m128i yearDay = _mm_sub_epi32(
+        _mm_add_epi32(
+            shiftedYearDay,
+            _mm_add_epi32(leapDay, _mm_set1_epi32(JAN_AND_FEB_DAYS +
+                                                  MONTH_DAY_OFFSET))),
+        _mm_and_si128(isJanOrFeb,
+                      _mm_add_epi32(leapDay,
+                                    _mm_set1_epi32(TINY_ONE_YEAR_IN_DAYS))));
+    // Pack the fields into the three words of a tinyTimeType
+    const __m128i dayTime = _mm_or_si128(
+        _mm_or_si128(sec, _mm_slli_epi32(min, SIMD_BYTE_BITS)),
+        _mm_or_si128(_mm_slli_epi32(hour, 2 * SIMD_BYTE_BITS),
+                     _mm_slli_epi32(monthDay, 3 * SIMD_BYTE_BITS)));
+    const __m128i date =
+        _mm_or_si128(month, _mm_slli_epi32(year, SIMD_HALF_BITS));
+    const __m128i days16 =
+        _mm_or_si128(weakDay, _mm_slli_epi32(yearDay, SIMD_HALF_BITS));
+    // Transpose the words into the four structures and store them
+    __m128i *dst = (__m128i *)&tm[i];
+    _mm_storeu_si128(
+        &dst[0],
+        _mm_blend_epi16(
+            _mm_blend_epi16(_mm_shuffle_epi32(dayTime, _MM_SHUFFLE(1, 0, 0, 0)),
+                            _mm_shuffle_epi32(date, _MM_SHUFFLE(0, 0, 0, 0)),
+                            0x0C),
+            _mm_shuffle_epi32(days16, _MM_SHUFFLE(0, 0, 0, 0)), 0x30));
+    _mm_storeu_si128(
+        &dst[1],
+        _mm_blend_epi16(
+            _mm_blend_epi16(_mm_shuffle_epi32(date, _MM_SHUFFLE(2, 0, 0, 1)),
+                            _mm_shuffle_epi32(days16, _MM_SHUFFLE(0, 0, 1, 0)),
+                            0x0C),
+            _mm_shuffle_epi32(dayTime, _MM_SHUFFLE(0, 2, 0, 0)), 0x30));
+    _mm_storeu_si128(
+        &dst[2],
+        _mm_blend_epi16(
+            _mm_blend_epi16(_mm_shuffle_epi32(days16, _MM_SHUFFLE(3, 0, 0, 2)),
+                            _mm_shuffle_epi32(dayTime, _MM_SHUFFLE(0, 0, 3, 0)),
+                            0x0C),
+            _mm_shuffle_epi32(date, _MM_SHUFFLE(0, 3, 0, 0)), 0x30));
+  }
+  return i;
+}
+
+/**
+ * @brief Loads the time and date words of four time types with SSE4.1.
+ *
+ * Transposes the first two 32 bit words of the structures into lanes.
+ *
+ * @param tm Array of four tinyTimeType structures
+ * @param dayTime Reference to store sec, min, hour and monthDay of the lanes
+ * @param date Reference to store month and year of the lanes
+ */
+__attribute__((target("sse4.1"))) static inline void
+tiny_loadTimeWordsSse41(const tinyTimeType *tm, __m128i *dayTime, __m128i *date)
+{
+  const __m128i *src = (const __m128i *)tm;
+  const __m128i first = _mm_loadu_si128(&src[0]);
+  const __m128i second = _mm_loadu_si128(&src[1]);
+  const __m128i third = _mm_loadu_si128(&src[2]);
+  *dayTime = _mm_shuffle_epi32(
+      _mm_blend_epi16(_mm_blend_epi16(first, second, 0x30), third, 0x0C),
+      _MM_SHUFFLE(1, 2, 3, 0));
+  *date = _mm_shuffle_epi32(
+      _mm_blend_epi16(_mm_blend_epi16(second, first, 0x0C), third, 0x30),
+      _MM_SHUFFLE(2, 3, 0, 1));
+}
+
+/**
+ * @brief Converts four time types to unix time with SSE4.1.
+ *
+ * @param tm Array of four tinyTimeType structures
+ * @param unixTimes Array to store the four unix times
+ * @return uint8_t The invalid lanes with bit i for lane i
+ */
+__attribute__((target("sse4.1"))) static inline uint8_t
+tiny_timeTypesToUnixTimeSse41(const tinyTimeType *tm, tinyUnixType *unixTimes)
+{
+  const __m128i byteMask = _mm_set1_epi32(SIMD_BYTE_MASK);
+  __m128i dayTime;
+  __m128i date;
+  tiny_loadTimeWordsSse41(tm, &dayTime, &date);
+  return tiny_fieldsToUnixTimeSse41(
+      _mm_srli_epi32(date, SIMD_HALF_BITS), _mm_and_si128(date, byteMask),
+      _mm_srli_epi32(dayTime, 3 * SIMD_BYTE_BITS),
+      _mm_and_si128(_mm_srli_epi32(dayTime, 2 * SIMD_BYTE_BITS), byteMask),
+      _mm_and_si128(_mm_srli_epi32(dayTime, SIMD_BYTE_BITS), byteMask),
+      _mm_and_si128(dayTime, byteMask), unixTimes);
+}
+
+/**
+ * @brief Converts time types to unix time with SSE4.1, eight at a time.
+ *
+ * @param unixTimes Array of count unix times to store the results
+ * @param tm Array of count tinyTimeType structures to convert
+ * @param count The number of elements to convert
+ * @param invalidMap Bitmap to mark the invalid elements or NULL
+ * @param invalidCount Reference to add the number of invalid elements
+ * @return size_t The number of converted elements, a multiple of eight
+ */
+__attribute__((target("sse4.1,popcnt"))) static size_t
+tiny_getUnixTimeSse41(tinyUnixType *unixTimes,
+                      const tinyTimeType *tm,
+                      const size_t count,
+                      uint8_t *invalidMap,
+                      size_t *invalidCount)
+{
+  size_t i = 0;
+  for (; i + SSE41_BLOCK <= count; i += SSE41_BLOCK) {
+    const uint8_t invalidBits = (uint8_t)(
+        tiny_timeTypesToUnixTimeSse41(&tm[i], &unixTimes[i]) |
+        (tiny_timeTypesToUnixTimeSse41(&tm[i + SSE41_LANES],
+                                       &unixTimes[i + SSE41_LANES])
+         << SSE41_LANES));
+    if (invalidMap) {
+      invalidMap[i / INVALID_MAP_BITS] = invalidBits;
+    }
+    *invalidCount += (size_t)__builtin_popcount(invalidBits);
+  }
+  return i;
+}
+
+/**
+ * @brief Converts eight lanes of time and date fields to unix time with AVX2.
+ *
+ * Same calculation as tiny_fieldsToUnixTimeSse41 on eight lanes.
+ *
+ * @param year The years of the lanes
+ * @param month The months of the lanes
+ * @param monthDay The month days of the lanes
+ * @param hour The hours of the lanes
+ * @param min The minutes of the lanes
+ * @param sec The seconds of the lanes
+ * @param unixTimes Array to store the eight unix times
+ * @return uint8_t The invalid lanes with bit i for lane i
+ */
+__attribute__((target("avx2"))) static inline uint8_t
+tiny_fieldsToUnixTimeAvx2(const __m256i year,
+                          const __m256i month,
+                          const __m256i monthDay,
+                          const __m256i hour,
+                          const __m256i min,
+                          const __m256i sec,
+                          tinyUnixType *unixTimes)
+{
+  const __m256i zero = _mm256_setzero_si256();
+  const __m256i three = _mm256_set1_epi32(3);
+  // Leap year and the days of the month
+  const __m256i century = tiny_divideAvx2(year, SIMD_100_DIVISOR);
+  const __m256i isLeapYear = _mm256_and_si256(
+      _mm256_cmpeq_epi32(_mm256_and_si256(year, three), zero),
+      _mm256_or_si256(
+          _mm256_xor_si256(
+              _mm256_cmpeq_epi32(
+                  year, _mm256_mullo_epi32(
+                            century, _mm256_set1_epi32(LEAP_YEAR_REMOVED))),
+              _mm256_set1_epi32(-1)),
+          _mm256_cmpeq_epi32(_mm256_and_si256(century, three), zero)));
+  const __m256i monthDays = _mm256_blendv_epi8(
+      _mm256_add_epi32(
+          _mm256_set1_epi32(MONTH_BASE_DAYS),
+          _mm256_and_si256(_mm256_add_epi32(month, _mm256_srli_epi32(month, 3)),
+                           _mm256_set1_epi32(1))),
+      _mm256_sub_epi32(_mm256_set1_epi32(FEB_DAYS), isLeapYear),
+      _mm256_cmpeq_epi32(month, _mm256_set1_epi32(TINY_FEB)));
+  // Check valid time, year, day and month
+  const __m256i invalid = _mm256_or_si256(
+      _mm256_or_si256(
+          _mm256_or_si256(
+              _mm256_cmpgt_epi32(sec, _mm256_set1_epi32(TINY_SEC_MAX)),
+              _mm256_cmpgt_epi32(min, _mm256_set1_epi32(TINY_MINUTE_MAX))),
+          _mm256_or_si256(
+              _mm256_cmpgt_epi32(hour, _mm256_set1_epi32(TINY_HOUR_MAX)),
+              _mm256_cmpgt_epi32(_mm256_set1_epi32(TINY_UNIX_YEAR_BEGIN),
+                                 year))),
+      _mm256_or_si256(
+          _mm256_or_si256(
+              _mm256_cmpeq_epi32(month, zero),
+              _mm256_cmpgt_epi32(month, _mm256_set1_epi32(TINY_DEC))),
+          _mm256_or_si256(_mm256_cmpeq_epi32(monthDay, zero),
+                          _mm256_cmpgt_epi32(monthDay, monthDays))));
+  // Days since the epoch with a march based year
+  const __m256i isJanOrFeb =
+      _mm256_cmpgt_epi32(_mm256_set1_epi32(TINY_MAR), month);
+  const __m256i shiftedYear = _mm256_add_epi32(year, isJanOrFeb);
+  const __m256i era = tiny_divideAvx2(shiftedYear, SIMD_400_DIVISOR);
+  const __m256i eraYear = _mm256_sub_epi32(
+      shiftedYear,
+      _mm256_mullo_epi32(era, _mm256_set1_epi32(LEAP_YEAR_CORRECTION)));
+  const __m256i shiftedMonth = _mm256_add_epi32(
+      _mm256_sub_epi32(month, _mm256_set1_epi32(TINY_MAR)),
+      _mm256_and_si256(isJanOrFeb,
+                       _mm256_set1_epi32(TINY_MAX_MONTHS - TINY_JAN)));
+  const __m256i shiftedYearDay = _mm256_add_epi32(
+      tiny_divideAvx2(
+          _mm256_add_epi32(
+              _mm256_mullo_epi32(shiftedMonth,
+                                 _mm256_set1_epi32(SHIFTED_MONTH_DAYS)),
+              _mm256_set1_epi32(SHIFTED_MONTH_ROUNDING)),
+          SIMD_5_DIVISOR),
+      _mm256_sub_epi32(monthDay, _mm256_set1_epi32(MONTH_DAY_OFFSET)));
+  const __m256i eraDay = _mm256_add_epi32(
+      _mm256_sub_epi32(
+          _mm256_add_epi32(
+              _mm256_mullo_epi32(eraYear,
+                                 _mm256_set1_epi32(TINY_ONE_YEAR_IN_DAYS)),
+              _mm256_srli_epi32(eraYear, 2)),
+          tiny_divideAvx2(eraYear, SIMD_100_DIVISOR)),
+      shiftedYearDay);
+  const __m256i days = _mm256_sub_epi32(
+      _mm256_add_epi32(_mm256_mullo_epi32(era, _mm256_set1_epi32(ERA_DAYS)),
+                       eraDay),
+      _mm256_set1_epi32(ERA_EPOCH_OFFSET_DAYS));
+  const __m256i secInDay = _mm256_add_epi32(
+      _mm256_add_epi32(
+          _mm256_mullo_epi32(hour, _mm256_set1_epi32(TINY_ONE_HOUR_IN_SEC)),
+          _mm256_mullo_epi32(min, _mm256_set1_epi32(TINY_ONE_MIN_IN_SEC))),
+      sec);
+  // Widen to 64 bit unix times, invalid lanes get all bits set
+  const __m256i daySeconds = _mm256_set1_epi64x(TINY_ONE_DAY_IN_SEC);
+  for (uint8_t half = 0; half < 2; half++) {
+    const uint8_t offset = (uint8_t)(half * 4);
+    const __m256i halfDays = _mm256_cvtepu32_epi64(
+        half ? _mm256_extracti128_si256(days, 1)
+             : _mm256_castsi256_si128(days));
+    const __m256i halfSeconds = _mm256_cvtepu32_epi64(
+        half ? _mm256_extracti128_si256(secInDay, 1)
+             : _mm256_castsi256_si128(secInDay));
+    const __m256i halfInvalid = _mm256_cvtepi32_epi64(
+        half ? _mm256_extracti128_si256(invalid, 1)
+             : _mm256_castsi256_si128(invalid));
+    _mm256_storeu_si256(
+        (__m256i *)&unixTimes[offset],
+        _mm256_or_si256(_mm256_add_epi64(_mm256_mul_epu32(halfDays, daySeconds),
+                                         halfSeconds),
+                        halfInvalid));
+  }
+  return (uint8_t)_mm256_movemask_ps(_mm256_castsi256_ps(invalid));
+}
+
+/**
+ * @brief Converts time columns to unix time with AVX2, eight at a time.
+ *
+ * @param unixTimes Array of count unix times to store the results
+ * @param columns The time and date columns to convert
+ * @param count The number of elements to convert
+ * @param invalidMap Bitmap to mark the invalid elements or NULL
+ * @param invalidCount Reference to add the number of invalid elements
+ * @return size_t The number of converted elements, a multiple of eight
+ */
+__attribute__((target("avx2,popcnt"))) static size_t
+tiny_getUnixTimeColumnsAvx2(tinyUnixType *unixTimes,
+                            const tinyTimeColumnsType *columns,
+                            const size_t count,
+                            uint8_t *invalidMap,
+                            size_t *invalidCount)
+{
+  size_t i = 0;
+  for (; i + AVX2_LANES <= count; i += AVX2_LANES) {
+    const uint8_t invalidBits = tiny_fieldsToUnixTimeAvx2(
+        _mm256_cvtepu16_epi32(
+            _mm_loadu_si128((const __m128i *)&columns->year[i])),
+        _mm256_cvtepu8_epi32(
+            _mm_loadl_epi64((const __m128i *)&columns->month[i])),
+        _mm256_cvtepu8_epi32(
+            _mm_loadl_epi64((const __m128i *)&columns->monthDay[i])),
+        _mm256_cvtepu8_epi32(
+            _mm_loadl_epi64((const __m128i *)&columns->hour[i])),
+        _mm256_cvtepu8_epi32(
+            _mm_loadl_epi64((const __m128i *)&columns->min[i])),
+        _mm256_cvtepu8_epi32(
+            _mm_loadl_epi64((const __m128i *)&columns->sec[i])),
+        &unixTimes[i]);
+    if (invalidMap) {
+      invalidMap[i / INVALID_MAP_BITS] = invalidBits;
+    }
+    *invalidCount += (size_t)__builtin_popcount(invalidBits);
+  }
+  return i;
+}
+
+/**
+ * @brief Converts time types to unix time with AVX2, eight at a time.
+ *
+ * The structures are transposed with SSE4.1 and converted on eight lanes.
+ *
+ * @param unixTimes Array of count unix times to store the results
+ * @param tm Array of count tinyTimeType structures to convert
+ * @param count The number of elements to convert
+ * @param invalidMap Bitmap to mark the invalid elements or NULL
+ * @param invalidCount Reference to add the number of invalid elements
+ * @return size_t The number of converted elements, a multiple of eight
+ */
+__attribute__((target("avx2,popcnt"))) static size_t
+tiny_getUnixTimeAvx2(tinyUnixType *unixTimes,
+                     const tinyTimeType *tm,
+                     const size_t count,
+                     uint8_t *invalidMap,
+                     size_t *invalidCount)
+{
+  const __m256i byteMask = _mm256_set1_epi32(SIMD_BYTE_MASK);
+  size_t i = 0;
+  for (; i + AVX2_LANES <= count; i += AVX2_LANES) {
+    __m128i dayTimeLow, dateLow, dayTimeHigh, dateHigh;
+    tiny_loadTimeWordsSse41(&tm[i], &dayTimeLow, &dateLow);
+    tiny_loadTimeWordsSse41(&tm[i + SSE41_LANES], &dayTimeHigh, &dateHigh);
+    const __m256i dayTime = _mm256_set_m128i(dayTimeHigh, dayTimeLow);
+    const __m256i date = _mm256_set_m128i(dateHigh, dateLow);
+    const uint8_t invalidBits = tiny_fieldsToUnixTimeAvx2(
+        _mm256_srli_epi32(date, SIMD_HALF_BITS),
+        _mm256_and_si256(date, byteMask),
+        _mm256_srli_epi32(dayTime, 3 * SIMD_BYTE_BITS),
+        _mm256_and_si256(_mm256_srli_epi32(dayTime, 2 * SIMD_BYTE_BITS),
+                         byteMask),
+        _mm256_and_si256(_mm256_srli_epi32(dayTime, SIMD_BYTE_BITS), byteMask),
+        _mm256_and_si256(dayTime, byteMask), &unixTimes[i]);
+    if (invalidMap) {
+      invalidMap[i / INVALID_MAP_BITS] = invalidBits;
+    }
+    *invalidCount += (size_t)__builtin_popcount(invalidBits);
+  }
+  return i;
+}
+#endif
+
+/**
+ * @brief Returns the SIMD level supported by the CPU.
+ *
+ * @return TINY_SIMD_LEVELS The highest supported level
+ */
+static TINY_SIMD_LEVELS tiny_getSupportedSimdLevel(void)
+{
+#ifdef TINY_TIME_X86_SIMD
+  if (__builtin_cpu_supports("avx512f")) {
+    return TINY_SIMD_AVX512;
+  }
+  if (__builtin_cpu_supports("avx2")) {
+    return TINY_SIMD_AVX2;
+  }
+  if (__builtin_cpu_supports("sse4.1")) {
+    return TINY_SIMD_SSE41;
+  }
+#endif
+  return TINY_SIMD_NONE;
+}
+
+/**
+ * @brief The SIMD level used by the batch conversions.
+ *
+ * TINY_MAX_SIMD_LEVELS until it is resolved on the first use. Accessed with
+ * relaxed atomics, threads resolving it at once store the same level.
+ */
+static TINY_SIMD_LEVELS activeSimdLevel = TINY_MAX_SIMD_LEVELS;
+
+#ifdef __GNUC__
+#define LOAD_SIMD_LEVEL()                                                      \
+  __atomic_load_n(&activeSimdLevel, __ATOMIC_RELAXED) ///< Reads the level
+#define STORE_SIMD_LEVEL(LEVEL)                                                \
+  __atomic_store_n(&activeSimdLevel, (LEVEL), __ATOMIC_RELAXED) ///< Sets it
+#else
+#define LOAD_SIMD_LEVEL() (activeSimdLevel) ///< Reads the level
+#define STORE_SIMD_LEVEL(LEVEL) (activeSimdLevel = (LEVEL)) ///< Sets it
+#endif
+
+/**
+ * @brief Returns the SIMD level used by the batch conversions.
+ *
+ * Resolves the level with the CPU features on the first call.
+ *
+ * @return TINY_SIMD_LEVELS The active SIMD level
+ */
+static inline TINY_SIMD_LEVELS tiny_getSimdLevel(void)
+{
+  TINY_SIMD_LEVELS level = LOAD_SIMD_LEVEL();
+  if (TINY_MAX_SIMD_LEVELS == level) {
+    level = tiny_getSupportedSimdLevel();
+    STORE_SIMD_LEVEL(level);
+  }
+  return level;
+}
+
+TINY_SIMD_LEVELS tiny_setSimdLevel(const TINY_SIMD_LEVELS maxLevel)
+{
+  const TINY_SIMD_LEVELS supportedLevel = tiny_getSupportedSimdLevel();
+  const TINY_SIMD_LEVELS level =
+      maxLevel < supportedLevel ? maxLevel : supportedLevel;
+  STORE_SIMD_LEVEL(level);
+  return level;
+}
+
+/**
+ * @brief Marks the first count elements of an invalid map.
+ *
+ * @param invalidMap Bitmap of (count + 7) / 8 bytes or NULL
+ * @param count The number of elements
+ * @return size_t The count
+ */
+static size_t tiny_markAllInvalid(uint8_t *invalidMap, const size_t count)
+{
+  if (NULL != invalidMap) {
+    memset(invalidMap, BYTE_ALL_BITS, count / INVALID_MAP_BITS);
+    if (0 != count % INVALID_MAP_BITS) {
+      invalidMap[count / INVALID_MAP_BITS] =
+          (uint8_t)((1U << (count % INVALID_MAP_BITS)) - 1U);
+    }
+  }
+  return count;
+}
+
+size_t tiny_getUnixTimeBatch(tinyUnixType *unixTimes,
+                             const tinyTimeType *tm,
+                             const size_t count,
+                             uint8_t *invalidMap)
+{
+  if (NULL == unixTimes || NULL == tm) {
+    return tiny_markAllInvalid(invalidMap, count);
+  }
+  size_t invalidCount = 0;
+  size_t i = 0;
+#ifdef TINY_TIME_X86_SIMD
+  switch (tiny_getSimdLevel()) {
+  case TINY_SIMD_AVX512:
+  case TINY_SIMD_AVX2:
+    i = tiny_getUnixTimeAvx2(unixTimes, tm, count, invalidMap, &invalidCount);
+    break;
+  case TINY_SIMD_SSE41:
+    i = tiny_getUnixTimeSse41(unixTimes, tm, count, invalidMap, &invalidCount);
+    break;
+  default:
+    break;
+  }
+#endif
+  // Remaining elements and CPUs without SIMD support
+  uint8_t invalidBits = 0;
+  for (; i < count; i++) {
+    const tinyUnixType unixTime = tiny_toUnixTime(&tm[i]);
+    const uint8_t isInvalid = (uint8_t)(ERROR_VALUE == unixTime);
+    unixTimes[i] = unixTime;
+    invalidCount += isInvalid;
+    invalidBits |= (uint8_t)(isInvalid << (i % INVALID_MAP_BITS));
+    // Store the bits of every completed byte and the last one
+    if ((INVALID_MAP_BITS - 1) == i % INVALID_MAP_BITS || i + 1 == count) {
+      if (invalidMap) {
+        invalidMap[i / INVALID_MAP_BITS] = invalidBits;
+      }
+      invalidBits = 0;
+    }
+  }
+  return invalidCount;
+}
+
+void tiny_getTimeTypeBatch(tinyTimeType *tm,
+                           const tinyUnixType *unixTimes,
+                           const size_t count)
+{
+  if (NULL == tm || NULL == unixTimes) {
+    return;
+  }
+  size_t i = 0;
+#ifdef TINY_TIME_X86_SIMD
+  switch (tiny_getSimdLevel()) {
+  case TINY_SIMD_AVX512:
+    i = tiny_getTimeTypeAvx512(tm, unixTimes, count);
+    break;
+  case TINY_SIMD_AVX2:
+    i = tiny_getTimeTypeAvx2(tm, unixTimes, count);
+    break;
+  case TINY_SIMD_SSE41:
+    i = tiny_getTimeTypeSse41(tm, unixTimes, count);
+    break;
+  default:
+    break;
+  }
+#endif
+  // Remaining elements and CPUs without SIMD support
+  for (; i < count; i++) {
+    tiny_toTimeType(&tm[i], unixTimes[i]);
+  }
+}
+
+size_t tiny_getUnixTimeColumns(tinyUnixType *unixTimes,
+                               const tinyTimeColumnsType *columns,
+                               const size_t count,
+                               uint8_t *invalidMap)
+{
+  if (NULL == unixTimes || NULL == columns || NULL == columns->year ||
+      NULL == columns->month || NULL == columns->monthDay ||
+      NULL == columns->hour || NULL == columns->min || NULL == columns->sec) {
+    return count;
+  }
+  size_t invalidCount = 0;
+  size_t i = 0;
+#ifdef TINY_TIME_X86_SIMD
+  switch (tiny_getSimdLevel()) {
+  case TINY_SIMD_AVX512:
+  case TINY_SIMD_AVX2:
+    i = tiny_getUnixTimeColumnsAvx2(unixTimes, columns, count, invalidMap,
+                                    &invalidCount);
+    break;
+  case TINY_SIMD_SSE41:
+    i = tiny_getUnixTimeColumnsSse41(unixTimes, columns, count, invalidMap,
+                                     &invalidCount);
+    break;
+  default:
+    break;
+  }
+#endif
+  // Remaining elements and CPUs without SIMD support
+  uint8_t invalidBits = 0;
+  for (; i < count; i++) {
+    const tinyUnixType unixTime = tiny_fieldsToUnixTime(
+        columns->year[i], columns->month[i], columns->monthDay[i],
+        columns->hour[i], columns->min[i], columns->sec[i]);
+    const uint8_t isInvalid = (uint8_t)(ERROR_VALUE == unixTime);
+    unixTimes[i] = unixTime;
+    invalidCount += isInvalid;
+    invalidBits |= (uint8_t)(isInvalid << (i % INVALID_MAP_BITS));
+    // Store the bits of every completed byte and the last one
+    if ((INVALID_MAP_BITS - 1) == i % INVALID_MAP_BITS || i + 1 == count) {
+      if (invalidMap) {
+        invalidMap[i / INVALID_MAP_BITS] = invalidBits;
+      }
+      invalidBits = 0;
+    }
+  }
+  return invalidCount;
+}
+
+/**
+ * @brief Writes an unsigned decimal number with a minimal width.
+ *
+ * @param dst The buffer to write to
+ * @param value The value to write
+ * @param width The minimal width, filled up with the pad character
+ * @param pad The character to fill up the width
+ * @return char* The end of the written number
+ */
+static char *tiny_writeDecimal(char *dst,
+                               uint16_t value,
+                               uint8_t width,
+                               const char pad)
+{
+#define MAX_DECIMAL_DIGITS (5U) ///< Digits of UINT16_MAX
+  char digits[MAX_DECIMAL_DIGITS];
+  uint8_t count = 0;
+  do {
+    digits[count++] = (char)('0' + value % DECIMAL_BASE);
+    value /= DECIMAL_BASE;
+  } while (value);
+  for (; width > count; width--) {
+    *dst++ = pad;
+  }
+  while (count) {
+    *dst++ = digits[--count];
+  }
+  return dst;
+}
+
+/**
+ * @brief Returns the length tiny_writeDecimal writes for a value.
+ *
+ * @param value The value to write
+ * @param width The minimal number of characters
+ * @return uint8_t The number of characters
+ */
+static inline uint8_t tiny_getDecimalLength(const uint16_t value,
+                                            const uint8_t width)
+{
+  const uint8_t digits =
+      (uint8_t)(1U + (value >= DECIMAL_BASE) + (value >= DIGIT_PAIRS) +
+                (value >= MIN_FOUR_DIGITS) + (value >= MAX_FOUR_DIGITS + 1U));
+  return digits > width ? digits : width;
+}
+
+/**
+ * @brief Writes the three letters of a weak day or month name.
+ *
+ * @param dst The buffer to write to
+ * @param name The three letters of the name
+ * @return char* The end of the written name
+ */
+static inline char *tiny_writeName(char *dst, const char *name)
+{
+  memcpy(dst, name, NAME_LENGTH);
+  return dst + NAME_LENGTH;
+}
+
+/**
+ * @brief Writes the format of any tinyTimeType with variable field widths.
+ *
+ * Writes the same as the ``%s %2d %s %4d %.2d:%.2d:%.2d`` printf format or
+ * the error messages of invalid weak days and months.
+ *
+ * @param dst The buffer of at least TINY_FORMAT_BUFFER_SIZE bytes
+ * @param tm The time to format
+ * @return size_t The length of the string without the null terminator
+ */
+static size_t tiny_formatVariable(char *dst, const tinyTimeType *tm)
+{
+#define DAY_ERROR "Day "                ///< Error prefix of a wrong weak day
+#define MONTH_ERROR "Month "            ///< Error prefix of a wrong month
+#define RANGE_ERROR " not in range"     ///< Error suffix of a wrong value
+#define LITERAL_LENGTH(LITERAL) (sizeof(LITERAL) - 1) ///< Without terminator
+#define ERROR_VALUE_WIDTH (3U)          ///< Width of the wrong value
+  char *end = dst;
+  if (IS_BIGGER(tm->weakDay, TINY_SAT)) {
+    memcpy(end, DAY_ERROR, LITERAL_LENGTH(DAY_ERROR));
+    end = tiny_writeDecimal(end + LITERAL_LENGTH(DAY_ERROR), tm->weakDay,
+                            ERROR_VALUE_WIDTH, ' ');
+    memcpy(end, RANGE_ERROR, LITERAL_LENGTH(RANGE_ERROR));
+    end += LITERAL_LENGTH(RANGE_ERROR);
+  } else if (IS_NOT_IN_RANGE(tm->month, TINY_JAN, TINY_DEC)) {
+    memcpy(end, MONTH_ERROR, LITERAL_LENGTH(MONTH_ERROR));
+    end = tiny_writeDecimal(end + LITERAL_LENGTH(MONTH_ERROR), tm->month,
+                            ERROR_VALUE_WIDTH, ' ');
+    memcpy(end, RANGE_ERROR, LITERAL_LENGTH(RANGE_ERROR));
+    end += LITERAL_LENGTH(RANGE_ERROR);
+  } else {
+    end = tiny_writeName(end, weakDayNames[tm->weakDay]);
+    *end++ = ' ';
+    end = tiny_writeDecimal(end, tm->monthDay, 2, ' ');
+    *end++ = ' ';
+    end = tiny_writeName(end, monthNames[tm->month - TINY_JAN]);
+    *end++ = ' ';
+    end = tiny_writeDecimal(end, tm->year, 4, ' ');
+    *end++ = ' ';
+    end = tiny_writeDecimal(end, tm->hour, 2, '0');
+    *end++ = ':';
+    end = tiny_writeDecimal(end, tm->min, 2, '0');
+    *end++ = ':';
+    end = tiny_writeDecimal(end, tm->sec, 2, '0');
+  }
+  *end = '\0';
+  return (size_t)(end - dst);
+}
+
+/**
+ * @brief Writes the fixed width format without a null terminator.
+ *
+ * Two digit stores at fixed offsets, the fields must have the ranges of the
+ * fixed width layout with a four digit year.
+ *
+ * @param dst The buffer of at least TINY_FORMAT_LENGTH bytes
+ * @param tm The time to format
+ */
+static inline void tiny_writeFixedFormat(char *dst, const tinyTimeType *tm)
+{
+  tiny_writeName(&dst[FORMAT_WEAK_DAY], weakDayNames[tm->weakDay]);
+  dst[FORMAT_WEAK_DAY + NAME_LENGTH] = ' ';
+  // Space padded month day without a branch
+  const char *monthDay = DIGIT_PAIR(tm->monthDay);
+  dst[FORMAT_MONTH_DAY] = tm->monthDay < DECIMAL_BASE ? ' ' : monthDay[0];
+  dst[FORMAT_MONTH_DAY + 1] = monthDay[1];
+  dst[FORMAT_MONTH - 1] = ' ';
+  tiny_writeName(&dst[FORMAT_MONTH], monthNames[tm->month - TINY_JAN]);
+  dst[FORMAT_YEAR - 1] = ' ';
+  memcpy(&dst[FORMAT_YEAR], DIGIT_PAIR(tm->year / DIGIT_PAIRS), 2);
+  memcpy(&dst[FORMAT_YEAR + 2], DIGIT_PAIR(tm->year % DIGIT_PAIRS), 2);
+  dst[FORMAT_HOUR - 1] = ' ';
+  memcpy(&dst[FORMAT_HOUR], DIGIT_PAIR(tm->hour), 2);
+  dst[FORMAT_MIN - 1] = ':';
+  memcpy(&dst[FORMAT_MIN], DIGIT_PAIR(tm->min), 2);
+  dst[FORMAT_SEC - 1] = ':';
+  memcpy(&dst[FORMAT_SEC], DIGIT_PAIR(tm->sec), 2);
+}
+
+/**
+ * @brief Checks if the fields of a time fit the fixed width layout.
+ *
+ * @param tm The time to check
+ * @return uint8_t 1 if all fields have their fixed width, 0 otherwise
+ */
+static inline uint8_t tiny_isFixedWidth(const tinyTimeType *tm)
+{
+  return (uint8_t)(!IS_BIGGER(tm->weakDay, TINY_SAT) &
+                   !IS_NOT_IN_RANGE(tm->month, TINY_JAN, TINY_DEC) &
+                   !IS_BIGGER(tm->monthDay, MAX_DIGIT_PAIR) &
+                   !IS_NOT_IN_RANGE(tm->year, MIN_FOUR_DIGITS, MAX_FOUR_DIGITS) &
+                   !IS_BIGGER(tm->hour, MAX_DIGIT_PAIR) &
+                   !IS_BIGGER(tm->min, MAX_DIGIT_PAIR) &
+                   !IS_BIGGER(tm->sec, MAX_DIGIT_PAIR));
+}
+
+size_t tiny_formatTo(char *buf, const size_t len, const tinyTimeType *tm)
+{
+  if (NULL == buf || NULL == tm || 0 == len) {
+    return 0;
+  }
+
+  // Fixed width layout with two digit stores at fixed offsets
+  if (tiny_isFixedWidth(tm) && len > TINY_FORMAT_LENGTH) {
+    tiny_writeFixedFormat(buf, tm);
+    buf[TINY_FORMAT_LENGTH] = '\0';
+    return TINY_FORMAT_LENGTH;
+  }
+
+  // Variable width fields and error messages
+  char formatBuffer[TINY_FORMAT_BUFFER_SIZE];
+  const size_t written = tiny_formatVariable(formatBuffer, tm);
+  // Do not return truncated strings
+  if (written >= len) {
+    buf[0] = '\0';
+    return 0;
+  }
+  memcpy(buf, formatBuffer, written + 1);
+  return written;
+}
+
+const char *tiny_getFormat(const tinyTimeType *tm)
+{
+  if (NULL == tm) {
+    return NULL;
+  }
+
+  static char formatBuffer[TINY_FORMAT_BUFFER_SIZE];
+  tiny_formatTo(formatBuffer, TINY_FORMAT_BUFFER_SIZE, tm);
+  return formatBuffer;
+}
+
+size_t tiny_formatLength(const tinyTimeType *tm)
+{
+  if (NULL == tm) {
+    return 0;
+  }
+  if (tiny_isFixedWidth(tm)) {
+    return TINY_FORMAT_LENGTH;
+  }
+
+  // Same fields as tiny_formatVariable
+  if (IS_BIGGER(tm->weakDay, TINY_SAT)) {
+    return LITERAL_LENGTH(DAY_ERROR) +
+           tiny_getDecimalLength(tm->weakDay, ERROR_VALUE_WIDTH) +
+           LITERAL_LENGTH(RANGE_ERROR);
+  }
+  if (IS_NOT_IN_RANGE(tm->month, TINY_JAN, TINY_DEC)) {
+    return LITERAL_LENGTH(MONTH_ERROR) +
+           tiny_getDecimalLength(tm->month, ERROR_VALUE_WIDTH) +
+           LITERAL_LENGTH(RANGE_ERROR);
+  }
+  // Names, four spaces and two colons
+  return 2U * NAME_LENGTH + 6U + tiny_getDecimalLength(tm->monthDay, 2) +
+         tiny_getDecimalLength(tm->year, 4) +
+         tiny_getDecimalLength(tm->hour, 2) +
+         tiny_getDecimalLength(tm->min, 2) + tiny_getDecimalLength(tm->sec, 2);
+}
+
+size_t tiny_formatUnix(char *buf, const size_t len, const tinyUnixType unixTime)
+{
+  if (NULL == buf || 0 == len) {
+    return 0;
+  }
+
+  // The fields of a converted unix time are in range, no checks needed
+  tinyTimeType tm;
+  tiny_toTimeType(&tm, unixTime);
+  if (!IS_BIGGER(unixTime, MAX_FOUR_DIGITS_UNIX_TIME) &&
+      len > TINY_FORMAT_LENGTH) {
+    tiny_writeFixedFormat(buf, &tm);
+    buf[TINY_FORMAT_LENGTH] = '\0';
+    return TINY_FORMAT_LENGTH;
+  }
+
+  // Years after 9999 and too small buffers
+  char formatBuffer[TINY_FORMAT_BUFFER_SIZE];
+  const size_t written = tiny_formatVariable(formatBuffer, &tm);
+  if (written >= len) {
+    buf[0] = '\0';
+    return 0;
+  }
+  memcpy(buf, formatBuffer, written + 1);
+  return written;
+}
+
+size_t tiny_formatUnixLength(const tinyUnixType unixTime)
+{
+  if (!IS_BIGGER(unixTime, MAX_FOUR_DIGITS_UNIX_TIME)) {
+    return TINY_FORMAT_LENGTH;
+  }
+  tinyTimeType tm;
+  tiny_toTimeType(&tm, unixTime);
+  return tiny_formatLength(&tm);
+}
+
+/**
+ * @brief Packs three letters into the low bytes of a little endian word
+ *
+ */
+#define NAME_WORD(A, B, C)                                                     \
+  ((int)((uint32_t)(A) | (uint32_t)(B) << 8 | (uint32_t)(C) << 16))
+
+/**
+ * @brief The weak day names as packed words
+ *
+ */
+static const int weakDayNameWords[TINY_MAX_WEAKDAYS] = {
+    [TINY_SUN] = NAME_WORD('S', 'u', 'n'), [TINY_MON] = NAME_WORD('M', 'o', 'n'),
+    [TINY_TUE] = NAME_WORD('T', 'u', 'e'), [TINY_WED] = NAME_WORD('W', 'e', 'd'),
+    [TINY_THU] = NAME_WORD('T', 'h', 'u'), [TINY_FRI] = NAME_WORD('F', 'r', 'i'),
+    [TINY_SAT] = NAME_WORD('S', 'a', 't')};
+
+/**
+ * @brief The month names as packed words
+ *
+ */
+static const int monthNameWords[TINY_MAX_MONTHS - TINY_JAN] = {
+    [TINY_JAN - TINY_JAN] = NAME_WORD('J', 'a', 'n'),
+    [TINY_FEB - TINY_JAN] = NAME_WORD('F', 'e', 'b'),
+    [TINY_MAR - TINY_JAN] = NAME_WORD('M', 'a', 'r'),
+    [TINY_APR - TINY_JAN] = NAME_WORD('A', 'p', 'r'),
+    [TINY_MAY - TINY_JAN] = NAME_WORD('M', 'a', 'y'),
+    [TINY_JUN - TINY_JAN] = NAME_WORD('J', 'u', 'n'),
+    [TINY_JUL - TINY_JAN] = NAME_WORD('J', 'u', 'l'),
+    [TINY_AUG - TINY_JAN] = NAME_WORD('A', 'u', 'g'),
+    [TINY_SEP - TINY_JAN] = NAME_WORD('S', 'e', 'p'),
+    [TINY_OCT - TINY_JAN] = NAME_WORD('O', 'c', 't'),
+    [TINY_NOV - TINY_JAN] = NAME_WORD('N', 'o', 'v'),
+    [TINY_DEC - TINY_JAN] = NAME_WORD('D', 'e', 'c')};
+
+#ifdef TINY_TIME_X86_SIMD
+#define SIMD_TENS_MAGIC (6554) ///< Reciprocal of 10 for 16 bit values below 100
+#define SIMD_ZERO_SHUFFLE (-1) ///< Shuffle index of a zero byte
+#define SIMD_CENTURY_MAGIC (5243) ///< Reciprocal of 100 for 16 bit values
+#define SIMD_CENTURY_SHIFT (3)    ///< Shift after the high multiplication
+
+/**
+ * @brief Converts sixteen 16 bit values below 100 to two ASCII digits each.
+ *
+ * @param values The values to convert
+ * @return __m256i The tens and ones digit of value i at byte 2i and 2i + 1
+ */
+__attribute__((target("avx2"))) static inline __m256i
+tiny_digitPairsAvx2(const __m256i values)
+{
+  const __m256i tens =
+      _mm256_mulhi_epu16(values, _mm256_set1_epi16(SIMD_TENS_MAGIC));
+  const __m256i ones = _mm256_sub_epi16(
+      values, _mm256_mullo_epi16(tens, _mm256_set1_epi16(DECIMAL_BASE)));
+  return _mm256_add_epi8(_mm256_or_si256(tens, _mm256_slli_epi16(ones, 8)),
+                         _mm256_set1_epi8('0'));
+}
+
+/**
+ * @brief Writes rows of the fixed width format with AVX2 shuffles.
+ *
+ * One row per 128 bit lane. The digits of all fields are calculated at once
+ * with multiplications and shuffled with the weak day and month names into
+ * the layout.
+ *
+ * @param buf The buffer of the first row
+ * @param stride The distance of the rows
+ * @param tm Array of count times to write
+ * @param unixTimes Array of the count unix times of the times
+ * @param count The number of rows to write
+ * @return size_t The number of written rows, a multiple of two
+ */
+__attribute__((target("avx2"))) static size_t
+tiny_writeFormatRowsAvx2(char *buf,
+                         const size_t stride,
+                         const tinyTimeType *tm,
+                         const tinyUnixType *unixTimes,
+                         const size_t count)
+{
+#define Z SIMD_ZERO_SHUFFLE
+  const __m256i dateShuffle = _mm256_setr_epi8(
+      Z, Z, Z, Z, 6, 7, Z, Z, Z, Z, Z, 8, 9, 10, 11, Z, Z, Z, Z, Z, 6, 7, Z, Z,
+      Z, Z, Z, 8, 9, 10, 11, Z);
+  // Weak day name at byte 0 and month name at byte 4 of the names
+  const __m256i nameShuffle = _mm256_setr_epi8(
+      0, 1, 2, Z, Z, Z, Z, 4, 5, 6, Z, Z, Z, Z, Z, Z, 0, 1, 2, Z, Z, Z, Z, 4, 5,
+      6, Z, Z, Z, Z, Z, Z);
+  const __m256i timeShuffle = _mm256_setr_epi8(
+      4, 5, Z, 2, 3, Z, 0, 1, Z, Z, Z, Z, Z, Z, Z, Z, 4, 5, Z, 2, 3, Z, 0, 1, Z,
+      Z, Z, Z, Z, Z, Z, Z);
+  const __m256i dateTemplate = _mm256_setr_epi8(
+      0, 0, 0, ' ', 0, 0, ' ', 0, 0, 0, ' ', 0, 0, 0, 0, ' ', 0, 0, 0, ' ', 0,
+      0, ' ', 0, 0, 0, ' ', 0, 0, 0, 0, ' ');
+  const __m256i timeTemplate = _mm256_setr_epi8(
+      0, 0, ':', 0, 0, ':', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, ':', 0, 0, ':',
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+  const __m256i monthDayPad = _mm256_setr_epi8(
+      0, 0, 0, 0, 0, 0, '0' - ' ', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      '0' - ' ', 0, 0, 0, 0, 0, 0, 0, 0, 0);
+#undef Z
+  size_t i = 0;
+  for (; i + 2 <= count; i += 2) {
+    if (IS_BIGGER(unixTimes[i] | unixTimes[i + 1], MAX_FOUR_DIGITS_UNIX_TIME)) {
+      for (size_t j = i; j < i + 2; j++) {
+        if (IS_BIGGER(unixTimes[j], MAX_FOUR_DIGITS_UNIX_TIME)) {
+          memset(&buf[j * stride], ' ', TINY_FORMAT_LENGTH);
+        } else {
+          tiny_writeFixedFormat(&buf[j * stride], &tm[j]);
+        }
+      }
+      continue;
+    }
+    // The first 8 bytes hold sec, min, hour, month day, month and the year
+    const __m256i fields = _mm256_inserti128_si256(
+        _mm256_castsi128_si256(_mm_loadl_epi64((const __m128i *)&tm[i])),
+        _mm_loadl_epi64((const __m128i *)&tm[i + 1]), 1);
+    const __m256i year =
+        _mm256_shufflelo_epi16(fields, _MM_SHUFFLE(3, 3, 3, 3));
+    const __m256i century = _mm256_srli_epi16(
+        _mm256_mulhi_epu16(year, _mm256_set1_epi16(SIMD_CENTURY_MAGIC)),
+        SIMD_CENTURY_SHIFT);
+    const __m256i centuryYear = _mm256_sub_epi16(
+        year, _mm256_mullo_epi16(century, _mm256_set1_epi16(DIGIT_PAIRS)));
+    const __m256i bytes = _mm256_unpacklo_epi8(fields, _mm256_setzero_si256());
+    const __m256i values = _mm256_blend_epi16(
+        bytes, _mm256_unpacklo_epi16(century, centuryYear), 0x30);
+    __m256i digits = tiny_digitPairsAvx2(values);
+    digits = _mm256_sub_epi8(
+        digits,
+        _mm256_and_si256(_mm256_cmpeq_epi8(digits, _mm256_set1_epi8('0')),
+                         monthDayPad));
+    const __m256i names = _mm256_setr_epi32(
+        weakDayNameWords[tm[i].weakDay], monthNameWords[tm[i].month - TINY_JAN],
+        0, 0, weakDayNameWords[tm[i + 1].weakDay],
+        monthNameWords[tm[i + 1].month - TINY_JAN], 0, 0);
+    const __m256i date = _mm256_or_si256(
+        _mm256_or_si256(_mm256_shuffle_epi8(digits, dateShuffle),
+                        _mm256_shuffle_epi8(names, nameShuffle)),
+        dateTemplate);
+    const __m256i time = _mm256_or_si256(
+        _mm256_shuffle_epi8(digits, timeShuffle), timeTemplate);
+    _mm_storeu_si128((__m128i *)&buf[i * stride],
+                     _mm256_castsi256_si128(date));
+    _mm_storel_epi64((__m128i *)&buf[i * stride + FORMAT_HOUR],
+                     _mm256_castsi256_si128(time));
+    _mm_storeu_si128((__m128i *)&buf[(i + 1) * stride],
+                     _mm256_extracti128_si256(date, 1));
+    _mm_storel_epi64((__m128i *)&buf[(i + 1) * stride + FORMAT_HOUR],
+                     _mm256_extracti128_si256(time, 1));
+  }
+  return i;
+}
+#endif
+
+/**
+ * @brief Writes rows of the fixed width format.
+ *
+ * Rows of unix times after the year 9999 are filled with spaces.
+ *
+ * @param buf The buffer of the first row
+ * @param stride The distance of the rows
+ * @param tm Array of count times to write
+ * @param unixTimes Array of the count unix times of the times
+ * @param count The number of rows to write
+ */
+static void tiny_writeFormatRows(char *buf,
+                                 const size_t stride,
+                                 const tinyTimeType *tm,
+                                 const tinyUnixType *unixTimes,
+                                 const size_t count)
+{
+  size_t i = 0;
+#ifdef TINY_TIME_X86_SIMD
+  switch (tiny_getSimdLevel()) {
+  case TINY_SIMD_AVX512:
+  case TINY_SIMD_AVX2:
+    i = tiny_writeFormatRowsAvx2(buf, stride, tm, unixTimes, count);
+    break;
+  default:
+    break;
+  }
+#endif
+  // Remaining rows and CPUs without SIMD support
+  for (; i < count; i++) {
+    if (IS_BIGGER(unixTimes[i], MAX_FOUR_DIGITS_UNIX_TIME)) {
+      memset(&buf[i * stride], ' ', TINY_FORMAT_LENGTH);
+    } else {
+      tiny_writeFixedFormat(&buf[i * stride], &tm[i]);
+    }
+  }
+}
+
+size_t tiny_formatBatch(char *buf,
+                        const size_t stride,
+                        const tinyUnixType *unixTimes,
+                        const size_t count,
+                        uint8_t *invalidMap)
+{
+  if (NULL == buf || NULL == unixTimes ||
+      IS_SMALLER(stride, TINY_FORMAT_LENGTH)) {
+    return count;
+  }
+  tinyTimeType tm[FORMAT_BATCH_CHUNK];
+  size_t invalidCount = 0;
+  uint8_t invalidBits = 0;
+  for (size_t i = 0; i < count; i += FORMAT_BATCH_CHUNK) {
+    const size_t chunk = IS_SMALLER(count - i, FORMAT_BATCH_CHUNK)
+                             ? count - i
+                             : FORMAT_BATCH_CHUNK;
+    tiny_getTimeTypeBatch(tm, &unixTimes[i], chunk);
+    tiny_writeFormatRows(&buf[i * stride], stride, tm, &unixTimes[i], chunk);
+    for (size_t j = 0; j < chunk; j++) {
+      const size_t row = i + j;
+      const uint8_t isInvalid =
+          (uint8_t)IS_BIGGER(unixTimes[row], MAX_FOUR_DIGITS_UNIX_TIME);
+      invalidCount += isInvalid;
+      invalidBits |= (uint8_t)(isInvalid << (row % INVALID_MAP_BITS));
+      // Store the bits of every completed byte and the last one
+      if ((INVALID_MAP_BITS - 1) == row % INVALID_MAP_BITS || row + 1 == count) {
+        if (invalidMap) {
+          invalidMap[row / INVALID_MAP_BITS] = invalidBits;
+        }
+        invalidBits = 0;
+      }
+    }
+  }
+  return invalidCount;
+}
+
+size_t tiny_formatBatchOffsets(char *data,
+                               const size_t dataLen,
+                               int32_t *offsets,
+                               const tinyUnixType *unixTimes,
+                               const size_t count)
+{
+  if (NULL == data || NULL == offsets || NULL == unixTimes) {
+    return 0;
+  }
+  // The offsets are limited to 32 bit like Arrow string arrays
+  const size_t capacity =
+      IS_BIGGER(dataLen, (size_t)INT32_MAX) ? (size_t)INT32_MAX : dataLen;
+  tinyTimeType tm[FORMAT_BATCH_CHUNK];
+  size_t end = 0;
+  offsets[0] = 0;
+  for (size_t i = 0; i < count; i += FORMAT_BATCH_CHUNK) {
+    const size_t chunk = IS_SMALLER(count - i, FORMAT_BATCH_CHUNK)
+                             ? count - i
+                             : FORMAT_BATCH_CHUNK;
+    tiny_getTimeTypeBatch(tm, &unixTimes[i], chunk);
+    // Rows of a whole chunk with four digit years in the data buffer
+    tinyUnixType maxUnixTime = 0;
+    for (size_t j = 0; j < chunk; j++) {
+      maxUnixTime =
+          IS_BIGGER(unixTimes[i + j], maxUnixTime) ? unixTimes[i + j] : maxUnixTime;
+    }
+    if (!IS_BIGGER(maxUnixTime, MAX_FOUR_DIGITS_UNIX_TIME) &&
+        !IS_SMALLER(capacity - end, chunk * TINY_FORMAT_LENGTH)) {
+      tiny_writeFormatRows(&data[end], TINY_FORMAT_LENGTH, tm, &unixTimes[i],
+                           chunk);
+      for (size_t j = 0; j < chunk; j++) {
+        end += TINY_FORMAT_LENGTH;
+        offsets[i + j + 1] = (int32_t)end;
+      }
+      continue;
+    }
+    for (size_t j = 0; j < chunk; j++) {
+      const size_t row = i + j;
+      if (!IS_BIGGER(unixTimes[row], MAX_FOUR_DIGITS_UNIX_TIME)) {
+        if (IS_SMALLER(capacity - end, TINY_FORMAT_LENGTH)) {
+          return row;
+        }
+        tiny_writeFixedFormat(&data[end], &tm[j]);
+        end += TINY_FORMAT_LENGTH;
+      } else {
+        // Years with five digits
+        char formatBuffer[TINY_FORMAT_BUFFER_SIZE];
+        const size_t written = tiny_formatVariable(formatBuffer, &tm[j]);
+        if (IS_SMALLER(capacity - end, written)) {
+          return row;
+        }
+        memcpy(&data[end], formatBuffer, written);
+        end += written;
+      }
+      offsets[row + 1] = (int32_t)end;
+    }
+  }
+  return count;
+}
+
+#define MONTH_HASH_MAGIC (26596U) ///< Perfect hash multiplier of month names
+#define MONTH_HASH_SHIFT (28U)    ///< Perfect hash shift of month names
+#define WEAK_DAY_HASH_MAGIC (2522U) ///< Perfect hash multiplier of weak days
+#define WEAK_DAY_HASH_SHIFT (29U)   ///< Perfect hash shift of weak days
+#define FORMAT_YEAR_WORD (8U) ///< Offset of the word of the year in the format
+#define ASCII_ZEROS (0x3030303030303030U) ///< '0' in every byte
+#define DIGIT_OVERFLOW (0x7676767676767676U) ///< Sets bit 7 of bytes above 9
+#define BYTE_HIGH_BITS (0x8080808080808080U) ///< Bit 7 of every byte
+#define DATE_DIGITS (0x0000FFFF00000000U) ///< Month day bytes of "Www dd M"
+#define DATE_SEPARATORS (0x00FF0000FF000000U) ///< Spaces of "Www dd M"
+#define DATE_SPACES (0x0020000020000000U)     ///< Spaces of "Www dd M"
+#define MONTH_DAY_PAD (0x0000001000000000U)   ///< Turns a space pad into '0'
+#define YEAR_DIGITS (0x00FFFFFFFF000000U)     ///< Year bytes of "on yyyy "
+#define YEAR_SEPARATORS (0xFF00000000FF0000U) ///< Spaces of "on yyyy "
+#define YEAR_SPACES (0x2000000000200000U)     ///< Spaces of "on yyyy "
+#define TIME_DIGITS (0xFFFF00FFFF00FFFFU)     ///< Digit bytes of "hh:mm:ss"
+#define TIME_SEPARATORS (0x00003A00003A0000U) ///< Colons of "hh:mm:ss"
+#define TIME_PAIRS (0xFF0000FF0000FF00U)  ///< Hour, minute and second pairs
+#define TIME_LIMITS (0x4400004400006800U) ///< Sets bit 7 above 23:59:59
+#define DIGIT_PAIR_MULTIPLIER (0xA01U) ///< Adds ten times a byte to the next
+#define BYTE_BITS (8U)                 ///< Bits of a byte
+#define BYTE_MASK (0xFFU)              ///< Mask of the lowest byte
+#define NAME_MASK (0xFFFFFFU)          ///< Bytes of a packed name
+
+/**
+ * @brief Returns byte INDEX of a word
+ *
+ */
+#define WORD_BYTE(WORD, INDEX) (((WORD) >> ((INDEX) * BYTE_BITS)) & BYTE_MASK)
+
+/**
+ * @brief Months of the perfect hash of the packed month names.
+ *
+ * Unused slots hold any month, its name never hashes to them.
+ */
+static const uint8_t monthHashes[1U << (UINT32_BITS - MONTH_HASH_SHIFT)] = {
+    [12] = TINY_JAN, [14] = TINY_FEB, [6] = TINY_MAR,  [7] = TINY_APR,
+    [4] = TINY_MAY,  [13] = TINY_JUN, [0] = TINY_JUL,  [15] = TINY_AUG,
+    [9] = TINY_SEP,  [3] = TINY_OCT,  [1] = TINY_NOV,  [5] = TINY_DEC,
+    [2] = TINY_JAN,  [8] = TINY_JAN,  [10] = TINY_JAN, [11] = TINY_JAN};
+
+/**
+ * @brief Weak days of the perfect hash of the packed weak day names.
+ *
+ * The unused slot holds any weak day, its name never hashes to it.
+ */
+static const uint8_t weakDayHashes[1U << (UINT32_BITS - WEAK_DAY_HASH_SHIFT)] =
+    {[2] = TINY_SUN, [1] = TINY_MON, [7] = TINY_TUE, [6] = TINY_WED,
+     [4] = TINY_THU, [0] = TINY_FRI, [3] = TINY_SAT, [5] = TINY_SUN};
+
+/**
+ * @brief Loads eight characters as a little endian word.
+ *
+ * @param src The characters
+ * @return uint64_t The packed characters, src[0] in the lowest byte
+ */
+static inline uint64_t tiny_loadWord(const char *src)
+{
+  uint64_t word;
+  memcpy(&word, src, sizeof(word));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  word = __builtin_bswap64(word);
+#endif
+  return word;
+}
+
+/**
+ * @brief Checks the digit bytes of a word.
+ *
+ * @param values The characters xor '0', the other bytes masked out
+ * @return uint64_t 0 if all bytes are below 10, bit 7 set in the others
+ */
+static inline uint64_t tiny_getNonDigits(const uint64_t values)
+{
+  return (values | (values + DIGIT_OVERFLOW)) & BYTE_HIGH_BITS;
+}
+
+/**
+ * @brief Returns the month candidate of a packed month name.
+ *
+ * @param monthWord The three letters packed like NAME_WORD
+ * @return uint8_t The only month the name can match, compare its packed name
+ */
+static inline uint8_t tiny_hashMonthName(const uint32_t monthWord)
+{
+  return monthHashes[(monthWord * MONTH_HASH_MAGIC) >> MONTH_HASH_SHIFT];
+}
+
+uint8_t tiny_parseFormat(const char *str, const size_t len, tinyTimeType *tm)
+{
+  if (NULL == str || NULL == tm || IS_SMALLER(len, TINY_FORMAT_LENGTH)) {
+    return 0;
+  }
+
+  // Three words hold all digits and separators
+  const uint64_t dateWord = tiny_loadWord(&str[FORMAT_WEAK_DAY]);
+  const uint64_t yearWord = tiny_loadWord(&str[FORMAT_YEAR_WORD]);
+  const uint64_t timeWord = tiny_loadWord(&str[FORMAT_HOUR]);
+  const uint8_t isPadded = (uint8_t)(' ' == str[FORMAT_MONTH_DAY]);
+  const uint64_t dateDigits =
+      ((dateWord + isPadded * MONTH_DAY_PAD) ^ ASCII_ZEROS) & DATE_DIGITS;
+  const uint64_t yearDigits = (yearWord ^ ASCII_ZEROS) & YEAR_DIGITS;
+  const uint64_t timeDigits = (timeWord ^ ASCII_ZEROS) & TIME_DIGITS;
+
+  // Byte i + 1 holds 10 * digit i + digit i + 1
+  const uint64_t datePairs = dateDigits * DIGIT_PAIR_MULTIPLIER;
+  const uint64_t yearPairs = yearDigits * DIGIT_PAIR_MULTIPLIER;
+  const uint64_t timePairs = timeDigits * DIGIT_PAIR_MULTIPLIER;
+  const uint8_t monthDay = (uint8_t)WORD_BYTE(datePairs, 5U);
+  const uint32_t century = (uint32_t)WORD_BYTE(yearPairs, 4U);
+  const uint32_t centuryYear = (uint32_t)WORD_BYTE(yearPairs, 6U);
+  const uint16_t year = (uint16_t)(century * DIGIT_PAIRS + centuryYear);
+  const uint8_t hour = (uint8_t)WORD_BYTE(timePairs, 1U);
+  const uint8_t min = (uint8_t)WORD_BYTE(timePairs, 4U);
+  const uint8_t sec = (uint8_t)WORD_BYTE(timePairs, 7U);
+
+  // Perfect hash candidates, verified with the packed names
+  const uint32_t monthWord =
+      (uint32_t)tiny_loadWord(&str[FORMAT_MONTH]) & NAME_MASK;
+  const uint32_t weakDayWord = (uint32_t)dateWord & NAME_MASK;
+  const uint8_t month = tiny_hashMonthName(monthWord);
+  const uint8_t weakDay =
+      weakDayHashes[(weakDayWord * WEAK_DAY_HASH_MAGIC) >> WEAK_DAY_HASH_SHIFT];
+
+  // The digit pairs give leap year and centuries without divisions
+  const uint32_t leapDay =
+      (uint32_t)(0 == centuryYear % LEAP_YEAR_FREQUENCY) &
+      ((uint32_t)(0 != centuryYear) |
+       (uint32_t)(0 == century % LEAP_YEAR_FREQUENCY));
+  const uint32_t monthIndex = (uint32_t)month - TINY_JAN;
+  const uint32_t monthDays =
+      daysPerMonth[monthIndex] + ((uint32_t)(TINY_FEB == month) & leapDay);
+  const uint16_t yearDay =
+      (uint16_t)(cumulativeMonthDays[monthIndex] +
+                 ((uint32_t)(month > TINY_FEB) & leapDay) + monthDay);
+  // A year of 365 days moves the weak day by one, 1.1.0001 was a monday
+  const uint32_t weakDayShift = (uint32_t)year - 1U +
+                                (uint32_t)year / LEAP_YEAR_FREQUENCY - century +
+                                century / LEAP_YEAR_FREQUENCY - leapDay +
+                                yearDay;
+
+  // Check layout, names, time, date and weak day with a single branch
+  if (tiny_getNonDigits(dateDigits) | tiny_getNonDigits(yearDigits) |
+      tiny_getNonDigits(timeDigits) |
+      (DATE_SPACES ^ (dateWord & DATE_SEPARATORS)) |
+      (YEAR_SPACES ^ (yearWord & YEAR_SEPARATORS)) |
+      (TIME_SEPARATORS ^ (timeWord & ~TIME_DIGITS)) |
+      (!isPadded & ('0' == str[FORMAT_MONTH_DAY])) |
+      ((uint32_t)monthNameWords[month - TINY_JAN] ^ monthWord) |
+      ((uint32_t)weakDayNameWords[weakDay] ^ weakDayWord) |
+      (BYTE_HIGH_BITS & ((timePairs & TIME_PAIRS) + TIME_LIMITS)) |
+      IS_SMALLER(year, TINY_UNIX_YEAR_BEGIN) |
+      IS_BIGGER((uint32_t)monthDay - MONTH_DAY_OFFSET,
+                monthDays - MONTH_DAY_OFFSET) |
+      (weakDayShift % TINY_MAX_WEAKDAYS != weakDay)) {
+    return 0;
+  }
+  tm->sec = sec;
+  tm->min = min;
+  tm->hour = hour;
+  tm->monthDay = monthDay;
+  tm->month = month;
+  tm->year = year;
+  tm->weakDay = weakDay;
+  tm->yearDay = yearDay;
+  return 1;
+}
+
+#define SYSLOG_MONTH_DAY (4U) ///< Offset of the month day in "Mmm dd hh:mm:ss"
+#define SYSLOG_TIME (7U)      ///< Offset of the time in "Mmm dd hh:mm:ss"
+
+/**
+ * @brief Reads the month name, month day and time of a RFC 3164 timestamp.
+ *
+ * The words of "Mmm dd h" and "Www dd M" have the month day and the spaces at
+ * the same positions, so the masks of tiny_parseFormat are reused.
+ *
+ * @param str The string of at least TINY_SYSLOG_LENGTH characters
+ * @param monthWord Reference to store the packed month name
+ * @param fields Reference to store the month day and the time
+ * @return uint64_t 0 if the layout, the digits and the time are valid
+ */
+static inline uint64_t tiny_readSyslogFields(const char *str,
+                                             uint32_t *monthWord,
+                                             tinyTimeType *fields)
+{
+  const uint64_t dateWord = tiny_loadWord(str);
+  const uint64_t timeWord = tiny_loadWord(&str[SYSLOG_TIME]);
+  const uint8_t isPadded = (uint8_t)(' ' == str[SYSLOG_MONTH_DAY]);
+  const uint64_t dateDigits =
+      ((dateWord + isPadded * MONTH_DAY_PAD) ^ ASCII_ZEROS) & DATE_DIGITS;
+  const uint64_t timeDigits = (timeWord ^ ASCII_ZEROS) & TIME_DIGITS;
+
+  // Byte i + 1 holds 10 * digit i + digit i + 1
+  const uint64_t datePairs = dateDigits * DIGIT_PAIR_MULTIPLIER;
+  const uint64_t timePairs = timeDigits * DIGIT_PAIR_MULTIPLIER;
+  fields->monthDay = (uint8_t)WORD_BYTE(datePairs, 5U);
+  fields->hour = (uint8_t)WORD_BYTE(timePairs, 1U);
+  fields->min = (uint8_t)WORD_BYTE(timePairs, 4U);
+  fields->sec = (uint8_t)WORD_BYTE(timePairs, 7U);
+  *monthWord = (uint32_t)dateWord & NAME_MASK;
+
+  return tiny_getNonDigits(dateDigits) | tiny_getNonDigits(timeDigits) |
+         (DATE_SPACES ^ (dateWord & DATE_SEPARATORS)) |
+         (TIME_SEPARATORS ^ (timeWord & ~TIME_DIGITS)) |
+         (!isPadded & ('0' == str[SYSLOG_MONTH_DAY])) |
+         IS_BIGGER(fields->hour, TINY_HOUR_MAX) |
+         IS_BIGGER(fields->min, TINY_MINUTE_MAX) |
+         IS_BIGGER(fields->sec, TINY_SEC_MAX);
+}
+
+/**
+ * @brief Infers the year of a month without year from a reference date.
+ *
+ * Timestamps are expected to be at most one month after the reference, e.g.
+ * a sender clock running ahead. Later months are from the previous year,
+ * january at a december reference is from the next year.
+ *
+ * @param month The month of the timestamp
+ * @param ref The reference date, e.g. the receive time
+ * @return uint16_t The inferred year
+ */
+static inline uint16_t tiny_inferYear(const uint8_t month,
+                                      const tinyTimeType *ref)
+{
+  return (uint16_t)(ref->year - IS_BIGGER(month, ref->month + 1U) +
+                    ((TINY_DEC == ref->month) & (TINY_JAN == month)));
+}
+
+uint8_t tiny_parseSyslog(const char *str,
+                         const size_t len,
+                         const tinyUnixType refTime,
+                         tinyTimeType *tm)
+{
+  if (NULL == str || NULL == tm || IS_SMALLER(len, TINY_SYSLOG_LENGTH)) {
+    return 0;
+  }
+
+  tinyTimeType fields;
+  uint32_t monthWord;
+  const uint64_t isInvalid = tiny_readSyslogFields(str, &monthWord, &fields);
+  const uint8_t month = tiny_hashMonthName(monthWord);
+  tinyTimeType ref;
+  tiny_toTimeType(&ref, refTime);
+  const uint16_t year = tiny_inferYear(month, &ref);
+
+  // Check layout, name, time and date with a single branch
+  if (isInvalid | ((uint32_t)monthNameWords[month - TINY_JAN] ^ monthWord) |
+      IS_SMALLER(year, TINY_UNIX_YEAR_BEGIN) |
+      IS_NOT_IN_RANGE(fields.monthDay, MONTH_DAY_OFFSET,
+                      tiny_getMonthDays(year, month))) {
+    return 0;
+  }
+  const uint16_t yearDay = tiny_getYearDay(year, month, fields.monthDay);
+  const uint32_t days = tiny_yearToDays(year) + yearDay - MONTH_DAY_OFFSET;
+  tm->sec = fields.sec;
+  tm->min = fields.min;
+  tm->hour = fields.hour;
+  tm->monthDay = fields.monthDay;
+  tm->month = month;
+  tm->year = year;
+  // 1.1.1970 was a thursday
+  tm->weakDay = (uint8_t)((days + TINY_THU) % TINY_MAX_WEAKDAYS);
+  tm->yearDay = yearDay;
+  return 1;
+}
+
+size_t tiny_parseSyslogBatch(tinyUnixType *unixTimes,
+                             const char *data,
+                             const int32_t *offsets,
+                             const size_t count,
+                             const tinyUnixType refTime,
+                             uint8_t *invalidMap)
+{
+  if (NULL == unixTimes || NULL == data || NULL == offsets) {
+    return count;
+  }
+  tinyTimeType ref;
+  tiny_toTimeType(&ref, refTime);
+
+  // Year inference and date of the month of the previous line. Sorted lines
+  // change the month at most once per month, all other lines only add the
+  // month day and the time. No month days reject lines of the initial word
+  uint32_t lastMonthWord = 0;
+  uint32_t monthStart = 0;
+  uint8_t monthDays = 0;
+  size_t invalidCount = 0;
+  uint8_t invalidBits = 0;
+  for (size_t i = 0; i < count; i++) {
+    const int64_t len = (int64_t)offsets[i + 1] - offsets[i];
+    uint64_t isInvalid = IS_SMALLER(len, (int64_t)TINY_SYSLOG_LENGTH);
+    unixTimes[i] = ERROR_VALUE;
+    if (!isInvalid) {
+      tinyTimeType fields;
+      uint32_t monthWord;
+      isInvalid = tiny_readSyslogFields(&data[offsets[i]], &monthWord, &fields);
+      if (monthWord != lastMonthWord) {
+        const uint8_t month = tiny_hashMonthName(monthWord);
+        const uint16_t year = tiny_inferYear(month, &ref);
+        lastMonthWord = monthWord;
+        monthDays = 0;
+        if (monthWord == (uint32_t)monthNameWords[month - TINY_JAN] &&
+            !IS_SMALLER(year, TINY_UNIX_YEAR_BEGIN)) {
+          monthDays = tiny_getMonthDays(year, month);
+          monthStart = tiny_yearToDays(year) + tiny_getYearDay(year, month, 0);
+        }
+      }
+      isInvalid |=
+          IS_NOT_IN_RANGE(fields.monthDay, MONTH_DAY_OFFSET, monthDays);
+      if (!isInvalid) {
+        unixTimes[i] =
+            (tinyUnixType)(monthStart + fields.monthDay - MONTH_DAY_OFFSET) *
+                TINY_ONE_DAY_IN_SEC +
+            fields.hour * TINY_ONE_HOUR_IN_SEC +
+            fields.min * TINY_ONE_MIN_IN_SEC + fields.sec;
+      }
+    }
+    invalidCount += 0 != isInvalid;
+    invalidBits |= (uint8_t)((0 != isInvalid) << (i % INVALID_MAP_BITS));
+    // Store the bits of every completed byte and the last one
+    if ((INVALID_MAP_BITS - 1) == i % INVALID_MAP_BITS || i + 1 == count) {
+      if (invalidMap) {
+        invalidMap[i / INVALID_MAP_BITS] = invalidBits;
+      }
+      invalidBits = 0;
+    }
+  }
+  return invalidCount;
+}
+
+#define EPOCH_MAX_DIGITS (20U)  ///< Digits of UINT64_MAX
+#define EPOCH_WORD_DIGITS (8U)  ///< Digits converted per word
+#define EPOCH_AUTO_SEC_DIGITS (11U)   ///< Most digits of seconds, until 5138
+#define EPOCH_AUTO_MILLI_DIGITS (14U) ///< Most digits of milliseconds
+#define EPOCH_AUTO_MICRO_DIGITS (17U) ///< Most digits of microseconds
+#define BYTE_LOW_BITS (0x0101010101010101U) ///< Bit 0 of every byte
+#define QUAD_MULTIPLIER (1U + (100U << 16)) ///< Adds 100 times a pair to the next
+#define QUAD_MASK (0x0000FFFF0000FFFFU)     ///< Four digit values of a word
+#define OCTET_MULTIPLIER                                                       \
+  (1U + ((uint64_t)10000U << 32)) ///< Adds 10000 times four digits to the next
+#define PAIR_MASK (0x00FF00FF00FF00FFU) ///< Two digit values of a word
+
+/**
+ * @brief Returns the number of leading digits of a string.
+ *
+ * Checks 8 characters per word, the position of the first non digit byte is
+ * counted without a loop over the bytes.
+ *
+ * @param str The string
+ * @param len The number of characters of the string
+ * @return size_t The number of leading digits, at most EPOCH_MAX_DIGITS + 1
+ */
+static inline size_t tiny_countDigits(const char *str, const size_t len)
+{
+  const size_t limit =
+      IS_BIGGER(len, EPOCH_MAX_DIGITS) ? EPOCH_MAX_DIGITS + 1U : len;
+  size_t count = 0;
+  while (!IS_BIGGER(count + EPOCH_WORD_DIGITS, limit)) {
+    const uint64_t nonDigits =
+        tiny_getNonDigits(tiny_loadWord(&str[count]) ^ ASCII_ZEROS);
+    // Ones in all bytes below the lowest non digit are summed in the top byte
+    const uint64_t lowest = nonDigits & (~nonDigits + 1U);
+    const uint64_t digits =
+        ((((lowest >> 7U) - 1U) & BYTE_LOW_BITS) * BYTE_LOW_BITS) >> 56U;
+    count += digits;
+    if (0 != nonDigits) {
+      return count;
+    }
+  }
+  while (count < limit && IS_SMALLER((uint8_t)(str[count] - '0'), 10U)) {
+    count++;
+  }
+  return count;
+}
+
+/**
+ * @brief Converts eight digit values of a word into their value.
+ *
+ * @param values The digit values, the first one in the lowest byte
+ * @return uint32_t The value of the eight digits
+ */
+static inline uint32_t tiny_readEightDigits(uint64_t values)
+{
+  values = ((values * DIGIT_PAIR_MULTIPLIER) >> BYTE_BITS) & PAIR_MASK;
+  values = ((values * QUAD_MULTIPLIER) >> (2U * BYTE_BITS)) & QUAD_MASK;
+  return (uint32_t)((values * OCTET_MULTIPLIER) >> (4U * BYTE_BITS));
+}
+
+/**
+ * @brief Loads the first digits of a string right aligned into a word.
+ *
+ * The bytes in front of the digits are zero, which reads as leading zeros.
+ *
+ * @param str The digits
+ * @param count The number of digits ranged from 1 to EPOCH_WORD_DIGITS
+ * @param len The number of characters of the string
+ * @return uint64_t The digit values, the last one in the highest byte
+ */
+static inline uint64_t tiny_loadLeadingDigits(const char *str,
+                                              const size_t count,
+                                              const size_t len)
+{
+  const uint32_t shift = (uint32_t)(EPOCH_WORD_DIGITS - count) * BYTE_BITS;
+  if (!IS_SMALLER(len, EPOCH_WORD_DIGITS)) {
+    return (tiny_loadWord(str) ^ ASCII_ZEROS) << shift;
+  }
+  // Short strings can not be loaded as a whole word
+  uint64_t values = 0;
+  for (size_t i = 0; i < count; i++) {
+    values |= (uint64_t)(uint8_t)(str[i] - '0') << (shift + i * BYTE_BITS);
+  }
+  return values;
+}
+
+tinyUnixType tiny_parseEpoch(const char *str,
+                             const size_t len,
+                             const TINY_EPOCH_UNITS unit,
+                             uint32_t *nanoSec)
+{
+  if (NULL == str || IS_BIGGER(unit, TINY_EPOCH_NANO)) {
+    return ERROR_VALUE;
+  }
+  const size_t count = tiny_countDigits(str, len);
+  if (0 == count || IS_BIGGER(count, EPOCH_MAX_DIGITS) ||
+      (EPOCH_MAX_DIGITS == count &&
+       0 < memcmp(str, "18446744073709551615", EPOCH_MAX_DIGITS))) {
+    return ERROR_VALUE;
+  }
+
+  // Split the digits from the end into words of 8, only the first word is
+  // loaded with the leading digits right aligned
+  uint64_t lowValues;
+  uint64_t middleValues = 0;
+  uint64_t highValues = 0;
+  if (IS_SMALLER(count, EPOCH_WORD_DIGITS)) {
+    lowValues = tiny_loadLeadingDigits(str, count, len);
+  } else {
+    lowValues = tiny_loadWord(&str[count - EPOCH_WORD_DIGITS]) ^ ASCII_ZEROS;
+    if (IS_SMALLER(count, 2U * EPOCH_WORD_DIGITS)) {
+      middleValues = count > EPOCH_WORD_DIGITS
+                         ? tiny_loadLeadingDigits(
+                               str, count - EPOCH_WORD_DIGITS, len)
+                         : 0;
+    } else {
+      middleValues =
+          tiny_loadWord(&str[count - 2U * EPOCH_WORD_DIGITS]) ^ ASCII_ZEROS;
+      highValues = count > 2U * EPOCH_WORD_DIGITS
+                       ? tiny_loadLeadingDigits(
+                             str, count - 2U * EPOCH_WORD_DIGITS, len)
+                       : 0;
+    }
+  }
+  const uint64_t high = tiny_readEightDigits(highValues);
+  const uint32_t middle = tiny_readEightDigits(middleValues);
+  const uint32_t low = tiny_readEightDigits(lowValues);
+
+  TINY_EPOCH_UNITS epochUnit = unit;
+  if (TINY_EPOCH_AUTO == unit) {
+    epochUnit = !IS_BIGGER(count, EPOCH_AUTO_SEC_DIGITS)     ? TINY_EPOCH_SEC
+                : !IS_BIGGER(count, EPOCH_AUTO_MILLI_DIGITS) ? TINY_EPOCH_MILLI
+                : !IS_BIGGER(count, EPOCH_AUTO_MICRO_DIGITS) ? TINY_EPOCH_MICRO
+                                                             : TINY_EPOCH_NANO;
+  }
+
+  // Split the digits into seconds and fraction, the divisions are 32 bit
+  tinyUnixType unixTime;
+  uint32_t fraction;
+  switch (epochUnit) {
+  case TINY_EPOCH_MILLI:
+    unixTime = high * 10000000000000U + middle * (tinyUnixType)100000U +
+               low / 1000U;
+    fraction = low % 1000U * 1000000U;
+    break;
+  case TINY_EPOCH_MICRO:
+    unixTime =
+        high * 10000000000U + middle * (tinyUnixType)100U + low / 1000000U;
+    fraction = low % 1000000U * 1000U;
+    break;
+  case TINY_EPOCH_NANO:
+    unixTime = high * 10000000U + middle / 10U;
+    fraction = middle % 10U * 100000000U + low;
+    break;
+  default:
+    unixTime =
+        high * 10000000000000000U + middle * (tinyUnixType)100000000U + low;
+    fraction = 0;
+    break;
+  }
+  if (NULL != nanoSec) {
+    *nanoSec = fraction;
+  }
+  return unixTime;
+}
+
+/**
+ * @brief Renders the unix time into the format cache.
+ *
+ * @param cache The reference to the format cache
+ * @param unixTime The unix time to format
+ */
+static void tiny_renderFormatCache(tinyFormatCacheType *cache,
+                                   const tinyUnixType unixTime)
+{
+  tinyTimeType tm;
+  tiny_toTimeType(&tm, unixTime);
+  cache->unixTime = unixTime;
+  cache->dayStart = unixTime - tm.hour * (tinyUnixType)TINY_ONE_HOUR_IN_SEC -
+                    tm.min * (tinyUnixType)TINY_ONE_MIN_IN_SEC - tm.sec;
+  cache->length =
+      (uint8_t)tiny_formatTo(cache->format, TINY_FORMAT_BUFFER_SIZE, &tm);
+}
+
+void tiny_initFormatCache(tinyFormatCacheType *cache)
+{
+  if (NULL == cache) {
+    return;
+  }
+  tiny_renderFormatCache(cache, 0);
+}
+
+const char *tiny_getFormatCached(tinyFormatCacheType *cache,
+                                 const tinyUnixType unixTime)
+{
+  if (NULL == cache) {
+    return NULL;
+  }
+  if (unixTime == cache->unixTime) {
+    return cache->format;
+  }
+  const tinyUnixType secSinceDayStart = unixTime - cache->dayStart;
+  if (IS_SMALLER(unixTime, cache->dayStart) ||
+      !IS_SMALLER(secSinceDayStart, TINY_ONE_DAY_IN_SEC)) {
+    tiny_renderFormatCache(cache, unixTime);
+    return cache->format;
+  }
+  // Patch the hh:mm:ss digits at the end of the string
+  const uint32_t secInDay = (uint32_t)secSinceDayStart;
+  const uint32_t secInHour = secInDay % TINY_ONE_HOUR_IN_SEC;
+  char *dayTime = &cache->format[cache->length - FORMAT_TIME_LENGTH];
+  memcpy(dayTime, DIGIT_PAIR(secInDay / TINY_ONE_HOUR_IN_SEC), 2);
+  memcpy(&dayTime[FORMAT_MIN - FORMAT_HOUR],
+         DIGIT_PAIR(secInHour / TINY_ONE_MIN_IN_SEC), 2);
+  memcpy(&dayTime[FORMAT_SEC - FORMAT_HOUR],
+         DIGIT_PAIR(secInHour % TINY_ONE_MIN_IN_SEC), 2);
+  cache->unixTime = unixTime;
+  return cache->format;
+}
+
+/**
+ * @brief Writes the date and time part of a RFC 3339 string.
+ *
+ * @param dst The buffer of at least RFC3339_TIME_LENGTH bytes
+ * @param tm The time to write with a four digit year
+ */
+static inline void tiny_writeRfc3339Time(char *dst, const tinyTimeType *tm)
+{
+  memcpy(&dst[RFC3339_YEAR], DIGIT_PAIR(tm->year / DIGIT_PAIRS), 2);
+  memcpy(&dst[RFC3339_YEAR + 2], DIGIT_PAIR(tm->year % DIGIT_PAIRS), 2);
+  dst[RFC3339_MONTH - 1] = '-';
+  memcpy(&dst[RFC3339_MONTH], DIGIT_PAIR(tm->month), 2);
+  dst[RFC3339_MONTH_DAY - 1] = '-';
+  memcpy(&dst[RFC3339_MONTH_DAY], DIGIT_PAIR(tm->monthDay), 2);
+  dst[RFC3339_HOUR - 1] = 'T';
+  memcpy(&dst[RFC3339_HOUR], DIGIT_PAIR(tm->hour), 2);
+  dst[RFC3339_MIN - 1] = ':';
+  memcpy(&dst[RFC3339_MIN], DIGIT_PAIR(tm->min), 2);
+  dst[RFC3339_SEC - 1] = ':';
+  memcpy(&dst[RFC3339_SEC], DIGIT_PAIR(tm->sec), 2);
+}
+
+/**
+ * @brief Writes all nine fraction digits of the nanoseconds.
+ *
+ * @param dst The buffer of at least TINY_RFC3339_MAX_FRACTION bytes
+ * @param nanoSec The nanoseconds ranged from 0 - 999999999
+ */
+static inline void tiny_writeNanoSec(char *dst, const uint32_t nanoSec)
+{
+#define NANO_FIRST_DIGIT (100000000U) ///< Value of the first fraction digit
+  const uint32_t rest = nanoSec % NANO_FIRST_DIGIT;
+  dst[0] = (char)('0' + nanoSec / NANO_FIRST_DIGIT);
+  memcpy(&dst[1], DIGIT_PAIR(rest / (DIGIT_PAIRS * DIGIT_PAIRS * DIGIT_PAIRS)),
+         2);
+  memcpy(&dst[3], DIGIT_PAIR(rest / (DIGIT_PAIRS * DIGIT_PAIRS) % DIGIT_PAIRS),
+         2);
+  memcpy(&dst[5], DIGIT_PAIR(rest / DIGIT_PAIRS % DIGIT_PAIRS), 2);
+  memcpy(&dst[7], DIGIT_PAIR(rest % DIGIT_PAIRS), 2);
+}
+
+size_t tiny_formatRfc3339(char *buf,
+                          const size_t len,
+                          const tinyUnixType unixTime,
+                          const uint32_t nanoSec,
+                          const uint8_t fractionDigits,
+                          const int16_t offsetMin)
+{
+  if (NULL == buf || 0 == len) {
+    return 0;
+  }
+  buf[0] = '\0';
+  const uint16_t offset = (uint16_t)(offsetMin < 0 ? -offsetMin : offsetMin);
+  const tinyUnixType offsetSec = (tinyUnixType)offset * TINY_ONE_MIN_IN_SEC;
+  if (IS_BIGGER(nanoSec, MAX_NANO_SEC) |
+      IS_BIGGER(fractionDigits, TINY_RFC3339_MAX_FRACTION) |
+      IS_BIGGER(offset, TINY_RFC3339_MAX_OFFSET) |
+      ((offsetMin < 0) & IS_SMALLER(unixTime, offsetSec)) |
+      IS_BIGGER(unixTime, MAX_FOUR_DIGITS_UNIX_TIME + offsetSec)) {
+    return 0;
+  }
+  const tinyUnixType localTime =
+      offsetMin < 0 ? unixTime - offsetSec : unixTime + offsetSec;
+  if (IS_BIGGER(localTime, MAX_FOUR_DIGITS_UNIX_TIME)) {
+    return 0;
+  }
+  tinyTimeType tm;
+  tiny_toTimeType(&tm, localTime);
+
+  // Write to the buffer if all nine fraction digits fit, the zone follows
+  // the requested digits and overwrites the remaining ones
+  char rfc3339Buffer[TINY_RFC3339_BUFFER_SIZE];
+  char *dst = len >= TINY_RFC3339_BUFFER_SIZE ? buf : rfc3339Buffer;
+  tiny_writeRfc3339Time(dst, &tm);
+  char *end = &dst[RFC3339_TIME_LENGTH];
+  if (fractionDigits) {
+    *end++ = '.';
+    tiny_writeNanoSec(end, nanoSec);
+    end += fractionDigits;
+  }
+  if (0 == offset) {
+    *end++ = 'Z';
+  } else {
+    end[0] = offsetMin < 0 ? '-' : '+';
+    memcpy(&end[1], DIGIT_PAIR(offset / TINY_ONE_MIN_IN_SEC), 2);
+    end[3] = ':';
+    memcpy(&end[4], DIGIT_PAIR(offset % TINY_ONE_MIN_IN_SEC), 2);
+    end += RFC3339_OFFSET_LENGTH;
+  }
+  *end = '\0';
+  const size_t written = (size_t)(end - dst);
+  if (dst == buf) {
+    return written;
+  }
+  // Do not return truncated strings
+  if (written >= len) {
+    return 0;
+  }
+  memcpy(buf, rfc3339Buffer, written + 1);
+  return written;
+}
+
+size_t tiny_formatRfc3339Length(const uint8_t fractionDigits,
+                                const int16_t offsetMin)
+{
+  if (IS_BIGGER(fractionDigits, TINY_RFC3339_MAX_FRACTION) |
+      IS_NOT_IN_RANGE(offsetMin, -TINY_RFC3339_MAX_OFFSET,
+                      TINY_RFC3339_MAX_OFFSET)) {
+    return 0;
+  }
+  // Date and time, the optional fraction with its dot and Z or +hh:mm
+  return RFC3339_TIME_LENGTH + (fractionDigits ? fractionDigits + 1U : 0U) +
+         (offsetMin ? RFC3339_OFFSET_LENGTH : 1U);
+}
+
+#define RFC3339_PAIRS (8U) ///< Digit pairs of the date and time, one spare
+#define RFC3339_DATE_DIGITS (0x00FFFF00FFFFFFFFU) ///< Digits of "YYYY-MM-"
+#define RFC3339_DATE_SEPARATORS (0xFF0000FF00000000U) ///< Dashes of "YYYY-MM-"
+#define RFC3339_DATE_DASHES (0x2D00002D00000000U)     ///< Dashes of "YYYY-MM-"
+#define RFC3339_DAY_WORD (8U) ///< Offset of the word "DDTHH:MM"
+#define RFC3339_DAY_SEPARATORS (0x00003A0000740000U) ///< 't' and ':' of the word
+#define RFC3339_TIME_WORD (11U) ///< Offset of the word "HH:MM:SS"
+#define ASCII_LOWER_CASE (0x20U) ///< Bit of lower case letters
+#define RFC3339_OFFSET_HOUR (1U) ///< Offset of the hours in +hh:mm
+#define RFC3339_OFFSET_MIN (4U)  ///< Offset of the minutes in +hh:mm
+#define RFC3339_DATE_MASK (0xFFFFFFU) ///< "DDT" bytes of the second word
+
+/**
+ * @enum RFC3339_FIELDS
+ * @brief The digit pairs of the date and time of a RFC 3339 string.
+ *
+ */
+typedef enum {
+  RFC3339_CENTURY = 0,
+  RFC3339_CENTURY_YEAR,
+  RFC3339_MONTH_PAIR,
+  RFC3339_MONTH_DAY_PAIR,
+  RFC3339_HOUR_PAIR,
+  RFC3339_MIN_PAIR,
+  RFC3339_SEC_PAIR
+} RFC3339_FIELDS;
+
+/**
+ * @enum PARSE_CACHE_LAYOUTS
+ * @brief The layouts of the date prefix of a parse cache.
+ *
+ */
+typedef enum {
+  PARSE_CACHE_EMPTY = 0, ///< Nothing cached yet
+  PARSE_CACHE_FORMAT,    ///< "Www dd Mmm yyyy " of tiny_getFormat
+  PARSE_CACHE_RFC3339    ///< "YYYY-MM-DDT" of RFC 3339
+} PARSE_CACHE_LAYOUTS;
+
+/**
+ * @brief Reads the date and time of a RFC 3339 string with 8 byte words.
+ *
+ * @param str The string of at least RFC3339_TIME_LENGTH characters
+ * @param pairs Array of RFC3339_PAIRS values to store the digit pairs
+ * @return uint8_t 1 if all digits and separators of "YYYY-MM-DDTHH:MM:SS"
+ * match, 0 otherwise
+ */
+static uint8_t tiny_readRfc3339Time(const char *str, uint8_t *pairs)
+{
+  const uint64_t dateWord = tiny_loadWord(&str[RFC3339_YEAR]);
+  const uint64_t dayWord = tiny_loadWord(&str[RFC3339_DAY_WORD]) |
+                           (uint64_t)ASCII_LOWER_CASE << (2U * BYTE_BITS);
+  const uint64_t timeWord = tiny_loadWord(&str[RFC3339_TIME_WORD]);
+  const uint64_t dateDigits = (dateWord ^ ASCII_ZEROS) & RFC3339_DATE_DIGITS;
+  const uint64_t dayDigits = (dayWord ^ ASCII_ZEROS) & TIME_DIGITS;
+  const uint64_t timeDigits = (timeWord ^ ASCII_ZEROS) & TIME_DIGITS;
+  if (tiny_getNonDigits(dateDigits) | tiny_getNonDigits(dayDigits) |
+      tiny_getNonDigits(timeDigits) |
+      (RFC3339_DATE_DASHES ^ (dateWord & RFC3339_DATE_SEPARATORS)) |
+      (RFC3339_DAY_SEPARATORS ^ (dayWord & ~TIME_DIGITS)) |
+      (TIME_SEPARATORS ^ (timeWord & ~TIME_DIGITS))) {
+    return 0;
+  }
+  // Byte i + 1 holds 10 * digit i + digit i + 1
+  const uint64_t datePairs = dateDigits * DIGIT_PAIR_MULTIPLIER;
+  const uint64_t dayPairs = dayDigits * DIGIT_PAIR_MULTIPLIER;
+  const uint64_t timePairs = timeDigits * DIGIT_PAIR_MULTIPLIER;
+  pairs[RFC3339_CENTURY] = (uint8_t)WORD_BYTE(datePairs, 1U);
+  pairs[RFC3339_CENTURY_YEAR] = (uint8_t)WORD_BYTE(datePairs, 3U);
+  pairs[RFC3339_MONTH_PAIR] = (uint8_t)WORD_BYTE(datePairs, 6U);
+  pairs[RFC3339_MONTH_DAY_PAIR] = (uint8_t)WORD_BYTE(dayPairs, 1U);
+  pairs[RFC3339_HOUR_PAIR] = (uint8_t)WORD_BYTE(dayPairs, 4U);
+  pairs[RFC3339_MIN_PAIR] = (uint8_t)WORD_BYTE(dayPairs, 7U);
+  pairs[RFC3339_SEC_PAIR] = (uint8_t)WORD_BYTE(timePairs, 7U);
+  return 1;
+}
+
+#ifdef TINY_TIME_X86_SIMD
+/**
+ * @brief Reads the date and time of a RFC 3339 string with SSE4.1.
+ *
+ * All digits and separators are validated with a single compare and
+ * movemask: the characters minus their lower bound have to be within the
+ * range of their position, 9 for digits and 0 for separators. The digits are
+ * converted with a multiply add of neighboured bytes.
+ *
+ * @param str The string of at least RFC3339_TIME_LENGTH characters
+ * @param pairs Array of RFC3339_PAIRS values to store the digit pairs
+ * @return uint8_t 1 if all digits and separators of "YYYY-MM-DDTHH:MM:SS"
+ * match, 0 otherwise
+ */
+__attribute__((target("sse4.1"))) static uint8_t
+tiny_readRfc3339TimeSse41(const char *str, uint8_t *pairs)
+{
+#define Z SIMD_ZERO_SHUFFLE
+  // The first 16 characters and the last 16 for ":SS"
+  const __m128i first = _mm_loadu_si128((const __m128i *)str);
+  const __m128i last = _mm_loadu_si128(
+      (const __m128i *)&str[RFC3339_TIME_LENGTH - sizeof(__m128i)]);
+  const __m128i firstBounds = _mm_setr_epi8('0', '0', '0', '0', '-', '0', '0',
+                                            '-', '0', '0', 't', '0', '0', ':',
+                                            '0', '0');
+  const __m128i firstRanges =
+      _mm_setr_epi8(9, 9, 9, 9, 0, 9, 9, 0, 9, 9, 0, 9, 9, 0, 9, 9);
+  const __m128i firstCase = _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                                          ASCII_LOWER_CASE, 0, 0, 0, 0, 0);
+  // Only ":SS" of the last characters, the others pass any value
+  const __m128i lastBounds = _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                                           0, ':', '0', '0');
+  const __m128i lastRanges = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                           -1, -1, -1, -1, 0, 9, 9);
+  const __m128i outOfRange = _mm_or_si128(
+      _mm_subs_epu8(_mm_sub_epi8(_mm_or_si128(first, firstCase), firstBounds),
+                    firstRanges),
+      _mm_subs_epu8(_mm_sub_epi8(last, lastBounds), lastRanges));
+  if (0xFFFF != _mm_movemask_epi8(
+                    _mm_cmpeq_epi8(outOfRange, _mm_setzero_si128()))) {
+    return 0;
+  }
+  // Gather the digits in pairs and add ten times the first of each pair
+  const __m128i zeros = _mm_set1_epi8('0');
+  const __m128i digits = _mm_or_si128(
+      _mm_shuffle_epi8(_mm_sub_epi8(first, zeros),
+                       _mm_setr_epi8(0, 1, 2, 3, 5, 6, 8, 9, 11, 12, 14, 15, Z,
+                                     Z, Z, Z)),
+      _mm_shuffle_epi8(_mm_sub_epi8(last, zeros),
+                       _mm_setr_epi8(Z, Z, Z, Z, Z, Z, Z, Z, Z, Z, Z, Z, 14,
+                                     15, Z, Z)));
+  const __m128i values = _mm_maddubs_epi16(
+      digits, _mm_setr_epi8(DECIMAL_BASE, 1, DECIMAL_BASE, 1, DECIMAL_BASE, 1,
+                            DECIMAL_BASE, 1, DECIMAL_BASE, 1, DECIMAL_BASE, 1,
+                            DECIMAL_BASE, 1, DECIMAL_BASE, 1));
+#undef Z
+  _mm_storel_epi64((__m128i *)pairs, _mm_packus_epi16(values, values));
+  return 1;
+}
+#endif
+
+/**
+ * @brief Reads two digits.
+ *
+ * @param src The characters
+ * @param value Reference to store the value of the digits
+ * @return uint8_t 1 if both characters are digits, 0 otherwise
+ */
+static inline uint8_t tiny_readDigitPair(const char *src, uint8_t *value)
+{
+  const uint8_t tens = (uint8_t)(src[0] - '0');
+  const uint8_t ones = (uint8_t)(src[1] - '0');
+  *value = (uint8_t)(tens * DECIMAL_BASE + ones);
+  return (uint8_t)(!IS_BIGGER(tens, DECIMAL_BASE - 1U) &
+                   !IS_BIGGER(ones, DECIMAL_BASE - 1U));
+}
+
+/**
+ * @brief Reads the fraction and the zone after the time of a RFC 3339 string.
+ *
+ * @param str The string with at least RFC3339_TIME_LENGTH + 1 characters
+ * @param len The number of characters of the string
+ * @param fraction Reference to store the nanoseconds
+ * @param offset Reference to store the signed UTC offset in minutes
+ * @return size_t The position after the zone, 0 in case of an invalid
+ * fraction or zone
+ */
+static size_t tiny_readRfc3339Zone(const char *str,
+                                   const size_t len,
+                                   uint32_t *fraction,
+                                   int16_t *offset)
+{
+  static const uint32_t fractionScales[TINY_RFC3339_MAX_FRACTION + 1] = {
+      1000000000U, 100000000U, 10000000U, 1000000U, 100000U,
+      10000U,      1000U,      100U,      10U,      1U};
+
+  // Fraction of any length, digits after the nanoseconds are cut off
+  size_t pos = RFC3339_TIME_LENGTH;
+  *fraction = 0;
+  if ('.' == str[pos]) {
+    const size_t fractionStart = ++pos;
+    for (; pos < len && !IS_BIGGER((uint8_t)(str[pos] - '0'), 9U); pos++) {
+      if (pos - fractionStart < TINY_RFC3339_MAX_FRACTION) {
+        *fraction = *fraction * DECIMAL_BASE + (uint8_t)(str[pos] - '0');
+      }
+    }
+    const size_t fractionDigits = pos - fractionStart;
+    if (0 == fractionDigits) {
+      return 0;
+    }
+    if (fractionDigits < TINY_RFC3339_MAX_FRACTION) {
+      *fraction *= fractionScales[fractionDigits];
+    }
+  }
+
+  // Z or a numeric offset
+  uint8_t offsetHour = 0;
+  uint8_t offsetMinute = 0;
+  const char zone = pos < len ? str[pos] : '\0';
+  if ('Z' == zone || 'z' == zone) {
+    pos++;
+  } else if (('+' == zone || '-' == zone) &&
+             !IS_SMALLER(len - pos, RFC3339_OFFSET_LENGTH) &&
+             tiny_readDigitPair(&str[pos + RFC3339_OFFSET_HOUR], &offsetHour) &&
+             ':' == str[pos + RFC3339_OFFSET_HOUR + 2U] &&
+             tiny_readDigitPair(&str[pos + RFC3339_OFFSET_MIN], &offsetMinute) &&
+             !IS_BIGGER(offsetHour, TINY_HOUR_MAX) &&
+             !IS_BIGGER(offsetMinute, TINY_MINUTE_MAX)) {
+    pos += RFC3339_OFFSET_LENGTH;
+  } else {
+    return 0;
+  }
+  const int16_t minutes =
+      (int16_t)(offsetHour * TINY_ONE_MIN_IN_SEC + offsetMinute);
+  *offset = '-' == zone ? (int16_t)-minutes : minutes;
+  return pos;
+}
+
+/**
+ * @brief Converts a local time with a UTC offset into a UTC unix time.
+ *
+ * @param localTime The local unix time
+ * @param offset The signed UTC offset in minutes
+ * @return tinyUnixType The UTC unix time, ERROR_VALUE if it is before the
+ * unix epoch
+ */
+static inline tinyUnixType tiny_localToUtc(const tinyUnixType localTime,
+                                           const int16_t offset)
+{
+  if (offset < 0) {
+    return localTime + (tinyUnixType)-offset * TINY_ONE_MIN_IN_SEC;
+  }
+  const tinyUnixType offsetSec = (tinyUnixType)offset * TINY_ONE_MIN_IN_SEC;
+  return IS_SMALLER(localTime, offsetSec) ? ERROR_VALUE
+                                          : localTime - offsetSec;
+}
+
+size_t tiny_parseRfc3339(const char *str,
+                         const size_t len,
+                         tinyUnixType *unixTime,
+                         uint32_t *nanoSec,
+                         int16_t *offsetMin)
+{
+  // The shortest string has a Z after the time
+  if (NULL == str || NULL == unixTime ||
+      IS_SMALLER(len, RFC3339_TIME_LENGTH + 1U)) {
+    return 0;
+  }
+
+  uint8_t pairs[RFC3339_PAIRS];
+  uint8_t isValid;
+#ifdef TINY_TIME_X86_SIMD
+  // The 19 characters fit into one 128 bit vector, wider levels would only
+  // add the cost of the upper lanes, so all levels share the SSE4.1 kernel
+  switch (tiny_getSimdLevel()) {
+  case TINY_SIMD_AVX512:
+  case TINY_SIMD_AVX2:
+  case TINY_SIMD_SSE41:
+    isValid = tiny_readRfc3339TimeSse41(str, pairs);
+    break;
+  default:
+    isValid = tiny_readRfc3339Time(str, pairs);
+    break;
+  }
+#else
+  isValid = tiny_readRfc3339Time(str, pairs);
+#endif
+  if (!isValid) {
+    return 0;
+  }
+
+  uint32_t fraction;
+  int16_t offset;
+  const size_t pos = tiny_readRfc3339Zone(str, len, &fraction, &offset);
+  if (0 == pos) {
+    return 0;
+  }
+
+  // Same validation as tiny_getUnixTime
+  const tinyUnixType localTime = tiny_fieldsToUnixTime(
+      (uint16_t)(pairs[RFC3339_CENTURY] * DIGIT_PAIRS +
+                 pairs[RFC3339_CENTURY_YEAR]),
+      pairs[RFC3339_MONTH_PAIR], pairs[RFC3339_MONTH_DAY_PAIR],
+      pairs[RFC3339_HOUR_PAIR], pairs[RFC3339_MIN_PAIR],
+      pairs[RFC3339_SEC_PAIR]);
+  // The UTC time must not be before the unix epoch
+  const tinyUnixType utcTime =
+      ERROR_VALUE == localTime ? ERROR_VALUE : tiny_localToUtc(localTime, offset);
+  if (ERROR_VALUE == utcTime) {
+    return 0;
+  }
+  *unixTime = utcTime;
+  if (NULL != nanoSec) {
+    *nanoSec = fraction;
+  }
+  if (NULL != offsetMin) {
+    *offsetMin = offset;
+  }
+  return pos;
+}
+
+/**
+ * @brief Reads the seconds of the day of a "hh:mm:ss" string.
+ *
+ * @param src The string of at least FORMAT_TIME_LENGTH characters
+ * @param secOfDay Reference to store the seconds since midnight
+ * @return uint8_t 1 if the time is valid, 0 otherwise
+ */
+static inline uint8_t tiny_readDayTime(const char *src, uint32_t *secOfDay)
+{
+  const uint64_t timeWord = tiny_loadWord(src);
+  const uint64_t timeDigits = (timeWord ^ ASCII_ZEROS) & TIME_DIGITS;
+  const uint64_t timePairs = timeDigits * DIGIT_PAIR_MULTIPLIER;
+  const uint8_t hour = (uint8_t)WORD_BYTE(timePairs, 1U);
+  const uint8_t min = (uint8_t)WORD_BYTE(timePairs, 4U);
+  const uint8_t sec = (uint8_t)WORD_BYTE(timePairs, 7U);
+  *secOfDay = (uint32_t)(hour * TINY_ONE_HOUR_IN_SEC +
+                         min * TINY_ONE_MIN_IN_SEC + sec);
+  return (uint8_t)!(tiny_getNonDigits(timeDigits) |
+                    (TIME_SEPARATORS ^ (timeWord & ~TIME_DIGITS)) |
+                    IS_BIGGER(hour, TINY_HOUR_MAX) |
+                    IS_BIGGER(min, TINY_MINUTE_MAX) |
+                    IS_BIGGER(sec, TINY_SEC_MAX));
+}
+
+void tiny_initParseCache(tinyParseCacheType *cache)
+{
+  if (NULL == cache) {
+    return;
+  }
+  cache->prefix[0] = 0;
+  cache->prefix[1] = 0;
+  cache->days = 0;
+  cache->layout = PARSE_CACHE_EMPTY;
+}
+
+uint8_t tiny_parseFormatCached(tinyParseCacheType *cache,
+                               const char *str,
+                               const size_t len,
+                               tinyUnixType *unixTime)
+{
+  if (NULL == cache || NULL == str || NULL == unixTime ||
+      IS_SMALLER(len, TINY_FORMAT_LENGTH)) {
+    return 0;
+  }
+  // "Www dd Mmm yyyy " fills both prefix words
+  const uint64_t prefix0 = tiny_loadWord(str);
+  const uint64_t prefix1 = tiny_loadWord(&str[sizeof(uint64_t)]);
+  uint32_t secOfDay;
+  if (PARSE_CACHE_FORMAT == cache->layout && prefix0 == cache->prefix[0] &&
+      prefix1 == cache->prefix[1]) {
+    if (!tiny_readDayTime(&str[FORMAT_HOUR], &secOfDay)) {
+      return 0;
+    }
+    *unixTime = cache->days * (tinyUnixType)TINY_ONE_DAY_IN_SEC + secOfDay;
+    return 1;
+  }
+
+  tinyTimeType tm;
+  if (!tiny_parseFormat(str, len, &tm)) {
+    return 0;
+  }
+  cache->prefix[0] = prefix0;
+  cache->prefix[1] = prefix1;
+  cache->days = tiny_yearToDays(tm.year) + tm.yearDay - MONTH_DAY_OFFSET;
+  cache->layout = PARSE_CACHE_FORMAT;
+  secOfDay = (uint32_t)(tm.hour * TINY_ONE_HOUR_IN_SEC +
+                        tm.min * TINY_ONE_MIN_IN_SEC + tm.sec);
+  *unixTime = cache->days * (tinyUnixType)TINY_ONE_DAY_IN_SEC + secOfDay;
+  return 1;
+}
+
+size_t tiny_parseRfc3339Cached(tinyParseCacheType *cache,
+                               const char *str,
+                               const size_t len,
+                               tinyUnixType *unixTime,
+                               uint32_t *nanoSec,
+                               int16_t *offsetMin)
+{
+  if (NULL == cache || NULL == str || NULL == unixTime ||
+      IS_SMALLER(len, RFC3339_TIME_LENGTH + 1U)) {
+    return 0;
+  }
+  // "YYYY-MM-DDT" is the first word and three bytes of the second
+  const uint64_t prefix0 = tiny_loadWord(str);
+  const uint64_t prefix1 =
+      tiny_loadWord(&str[sizeof(uint64_t)]) & RFC3339_DATE_MASK;
+  if (PARSE_CACHE_RFC3339 != cache->layout || prefix0 != cache->prefix[0] ||
+      prefix1 != cache->prefix[1]) {
+    int16_t offset;
+    const size_t pos = tiny_parseRfc3339(str, len, unixTime, nanoSec, &offset);
+    if (0 == pos) {
+      return 0;
+    }
+    // The days of the local date, the offset keeps it after the epoch
+    uint32_t secOfDay;
+    const tinyUnixType localTime =
+        *unixTime + (tinyUnixType)((int32_t)offset * TINY_ONE_MIN_IN_SEC);
+    cache->prefix[0] = prefix0;
+    cache->prefix[1] = prefix1;
+    cache->days = (uint32_t)tiny_divide(localTime, DAY_DIVISOR, &secOfDay);
+    cache->layout = PARSE_CACHE_RFC3339;
+    if (NULL != offsetMin) {
+      *offsetMin = offset;
+    }
+    return pos;
+  }
+
+  uint32_t secOfDay;
+  uint32_t fraction;
+  int16_t offset;
+  const size_t pos = tiny_readRfc3339Zone(str, len, &fraction, &offset);
+  if (!tiny_readDayTime(&str[RFC3339_HOUR], &secOfDay) || 0 == pos) {
+    return 0;
+  }
+  const tinyUnixType utcTime = tiny_localToUtc(
+      cache->days * (tinyUnixType)TINY_ONE_DAY_IN_SEC + secOfDay, offset);
+  if (ERROR_VALUE == utcTime) {
+    return 0;
+  }
+  *unixTime = utcTime;
+  if (NULL != nanoSec) {
+    *nanoSec = fraction;
+  }
+  if (NULL != offsetMin) {
+    *offsetMin = offset;
+  }
+  return pos;
+}
+
+/**
+ * @brief Parses the timestamp at the start of a stream line.
+ *
+ * @param cache The date cache of the stream
+ * @param line The start of the line without the newline
+ * @param len The number of characters of the line start
+ * @return tinyUnixType The unix time, ERROR_VALUE if the line does not start
+ * with a valid timestamp
+ */
+static tinyUnixType tiny_parseStreamLine(tinyParseCacheType *cache,
+                                         const char *line,
+                                         const size_t len)
+{
+  tinyUnixType unixTime;
+  // The dash after the year tells RFC 3339 from the tiny_getFormat layout
+  const uint8_t isParsed =
+      IS_BIGGER(len, RFC3339_MONTH - 1U) && '-' == line[RFC3339_MONTH - 1U]
+          ? (uint8_t)(0 != tiny_parseRfc3339Cached(cache, line, len, &unixTime,
+                                                    NULL, NULL))
+          : tiny_parseFormatCached(cache, line, len, &unixTime);
+  return isParsed ? unixTime : ERROR_VALUE;
+}
+
+void tiny_initStreamParser(tinyStreamParserType *parser)
+{
+  if (NULL == parser) {
+    return;
+  }
+  tiny_initParseCache(&parser->cache);
+  parser->isSkipping = 0;
+  parser->carryLength = 0;
+}
+
+size_t tiny_parseStream(tinyStreamParserType *parser,
+                        tinyUnixType *unixTimes,
+                        const size_t count,
+                        const char *data,
+                        const size_t len,
+                        size_t *used)
+{
+  if (NULL == parser || NULL == unixTimes || NULL == data || NULL == used) {
+    return 0;
+  }
+  size_t pos = 0;
+  size_t parsed = 0;
+  while (pos < len) {
+    // The rest of a line after its timestamp
+    if (parser->isSkipping) {
+      const char *lineEnd = memchr(&data[pos], '\n', len - pos);
+      if (NULL == lineEnd) {
+        pos = len;
+        break;
+      }
+      pos = (size_t)(lineEnd - data) + 1U;
+      parser->isSkipping = 0;
+      continue;
+    }
+    if (parsed == count) {
+      break;
+    }
+
+    // The window of the line start, ends early at the newline
+    const size_t available = len - pos;
+    const size_t windowLen =
+        IS_SMALLER(available, TINY_STREAM_WINDOW - parser->carryLength)
+            ? available
+            : TINY_STREAM_WINDOW - parser->carryLength;
+    const char *lineEnd = memchr(&data[pos], '\n', windowLen);
+    const size_t lineLen =
+        NULL == lineEnd ? windowLen : (size_t)(lineEnd - &data[pos]);
+    if (NULL == lineEnd &&
+        IS_SMALLER(parser->carryLength + windowLen, TINY_STREAM_WINDOW)) {
+      // The chunk ends within the window, keep the bytes for the next chunk
+      memcpy(&parser->carry[parser->carryLength], &data[pos], windowLen);
+      parser->carryLength = (uint8_t)(parser->carryLength + windowLen);
+      pos = len;
+      break;
+    }
+    if (0 == parser->carryLength) {
+      // Parse in place, the whole window is in the chunk
+      unixTimes[parsed++] =
+          tiny_parseStreamLine(&parser->cache, &data[pos], lineLen);
+    } else {
+      memcpy(&parser->carry[parser->carryLength], &data[pos], lineLen);
+      unixTimes[parsed++] = tiny_parseStreamLine(
+          &parser->cache, parser->carry, parser->carryLength + lineLen);
+      parser->carryLength = 0;
+    }
+    // The newline is found again while skipping
+    pos += lineLen;
+    parser->isSkipping = 1;
+  }
+  *used = pos;
+  return parsed;
+}
+
+uint8_t tiny_finishStream(tinyStreamParserType *parser, tinyUnixType *unixTime)
+{
+  if (NULL == parser || NULL == unixTime) {
+    return 0;
+  }
+  const uint8_t isPending = (uint8_t)(0 != parser->carryLength);
+  if (isPending) {
+    *unixTime = tiny_parseStreamLine(&parser->cache, parser->carry,
+                                     parser->carryLength);
+  }
+  parser->isSkipping = 0;
+  parser->carryLength = 0;
+  return isPending;
+}
+
+/**
+ * @brief Writes the IMF-fixdate string of a unix time until the year 9999.
+ *
+ * @param dst The buffer of at least TINY_HTTP_DATE_LENGTH + 1 bytes
+ * @param unixTime The unix time to format
+ */
+static void tiny_writeHttpDate(char *dst, const tinyUnixType unixTime)
+{
+  tinyTimeType tm;
+  tiny_toTimeType(&tm, unixTime);
+  tiny_writeName(&dst[HTTP_DATE_WEAK_DAY], weakDayNames[tm.weakDay]);
+  dst[HTTP_DATE_MONTH_DAY - 2] = ',';
+  dst[HTTP_DATE_MONTH_DAY - 1] = ' ';
+  memcpy(&dst[HTTP_DATE_MONTH_DAY], DIGIT_PAIR(tm.monthDay), 2);
+  dst[HTTP_DATE_MONTH - 1] = ' ';
+  tiny_writeName(&dst[HTTP_DATE_MONTH], monthNames[tm.month - TINY_JAN]);
+  dst[HTTP_DATE_YEAR - 1] = ' ';
+  memcpy(&dst[HTTP_DATE_YEAR], DIGIT_PAIR(tm.year / DIGIT_PAIRS), 2);
+  memcpy(&dst[HTTP_DATE_YEAR + 2], DIGIT_PAIR(tm.year % DIGIT_PAIRS), 2);
+  dst[HTTP_DATE_HOUR - 1] = ' ';
+  memcpy(&dst[HTTP_DATE_HOUR], DIGIT_PAIR(tm.hour), 2);
+  dst[HTTP_DATE_MIN - 1] = ':';
+  memcpy(&dst[HTTP_DATE_MIN], DIGIT_PAIR(tm.min), 2);
+  dst[HTTP_DATE_SEC - 1] = ':';
+  memcpy(&dst[HTTP_DATE_SEC], DIGIT_PAIR(tm.sec), 2);
+  memcpy(&dst[HTTP_DATE_ZONE], " GMT", 5);
+}
+
+size_t tiny_formatHttpDate(char *buf,
+                           const size_t len,
+                           const tinyUnixType unixTime)
+{
+  if (NULL == buf || 0 == len) {
+    return 0;
+  }
+  if (len <= TINY_HTTP_DATE_LENGTH ||
+      IS_BIGGER(unixTime, MAX_FOUR_DIGITS_UNIX_TIME)) {
+    buf[0] = '\0';
+    return 0;
+  }
+  tiny_writeHttpDate(buf, unixTime);
+  return TINY_HTTP_DATE_LENGTH;
+}
+
+#ifdef __GNUC__
+void tiny_initHttpDate(tinyHttpDateType *date)
+{
+  if (NULL == date) {
+    return;
+  }
+  date->sequence = 0;
+  date->unixTime[0] = 0;
+  date->unixTime[1] = 0;
+  memset(date->words, 0, sizeof(date->words));
+  tiny_writeHttpDate((char *)date->words, 0);
+}
+
+size_t tiny_getHttpDate(tinyHttpDateType *date,
+                        const tinyUnixType now,
+                        char *buf,
+                        const size_t len)
+{
+  if (NULL == date || NULL == buf || 0 == len) {
+    return 0;
+  }
+  if (len <= TINY_HTTP_DATE_LENGTH || IS_BIGGER(now, MAX_FOUR_DIGITS_UNIX_TIME)) {
+    buf[0] = '\0';
+    return 0;
+  }
+  const uint32_t nowLow = (uint32_t)now;
+  const uint32_t nowHigh = (uint32_t)(now >> UINT32_BITS);
+
+  // Sequence lock read, no other thread writes while the sequence is even
+  // and unchanged
+  const uint32_t sequence = __atomic_load_n(&date->sequence, __ATOMIC_ACQUIRE);
+  if (!(sequence & 1U) &&
+      nowLow == __atomic_load_n(&date->unixTime[0], __ATOMIC_RELAXED) &&
+      nowHigh == __atomic_load_n(&date->unixTime[1], __ATOMIC_RELAXED)) {
+    // Copy word wise to the buffer, the last word only until the terminator
+    for (uint8_t i = 0; i < HTTP_DATE_WORDS - 1U; i++) {
+      const uint32_t word = __atomic_load_n(&date->words[i], __ATOMIC_RELAXED);
+      memcpy(&buf[i * sizeof(uint32_t)], &word, sizeof(uint32_t));
+    }
+    const uint32_t word =
+        __atomic_load_n(&date->words[HTTP_DATE_WORDS - 1U], __ATOMIC_RELAXED);
+    memcpy(&buf[(HTTP_DATE_WORDS - 1U) * sizeof(uint32_t)], &word,
+           TINY_HTTP_DATE_LENGTH + 1 - (HTTP_DATE_WORDS - 1U) * sizeof(uint32_t));
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    if (sequence == __atomic_load_n(&date->sequence, __ATOMIC_RELAXED)) {
+      return TINY_HTTP_DATE_LENGTH;
+    }
+  }
+
+  // New second or concurrent update, format it and publish it if no other
+  // thread is writing
+  uint32_t words[HTTP_DATE_WORDS] = {0};
+  tiny_writeHttpDate((char *)words, now);
+  memcpy(buf, words, TINY_HTTP_DATE_LENGTH + 1);
+  uint32_t expected = sequence & ~1U;
+  if (__atomic_compare_exchange_n(&date->sequence, &expected, expected + 1U,
+                                  0, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    __atomic_store_n(&date->unixTime[0], nowLow, __ATOMIC_RELAXED);
+    __atomic_store_n(&date->unixTime[1], nowHigh, __ATOMIC_RELAXED);
+    for (uint8_t i = 0; i < HTTP_DATE_WORDS; i++) {
+      __atomic_store_n(&date->words[i], words[i], __ATOMIC_RELAXED);
+    }
+    __atomic_store_n(&date->sequence, expected + 2U, __ATOMIC_RELEASE);
+  }
+  return TINY_HTTP_DATE_LENGTH;
+}
+#endif
+
+/**
+ * @enum FORMAT_OPS
+ * @brief Operations of a compiled format program.
+ *
+ */
+typedef enum {
+  FORMAT_OP_LITERAL = 0,   ///< Copy literal characters
+  FORMAT_OP_WEAK_DAY_NAME, ///< %a
+  FORMAT_OP_WEAK_DAY_FULL, ///< %A
+  FORMAT_OP_MONTH_NAME,    ///< %b and %h
+  FORMAT_OP_MONTH_FULL,    ///< %B
+  FORMAT_OP_CENTURY,       ///< %C
+  FORMAT_OP_MONTH_DAY,     ///< %d
+  FORMAT_OP_MONTH_DAY_PAD, ///< %e
+  FORMAT_OP_HOUR,          ///< %H
+  FORMAT_OP_HOUR_12,       ///< %I
+  FORMAT_OP_YEAR_DAY,      ///< %j
+  FORMAT_OP_MONTH,         ///< %m
+  FORMAT_OP_MIN,           ///< %M
+  FORMAT_OP_AM_PM,         ///< %p
+  FORMAT_OP_SEC,           ///< %S
+  FORMAT_OP_WEAK_DAY_MON,  ///< %u
+  FORMAT_OP_WEEK_SUN,      ///< %U
+  FORMAT_OP_WEAK_DAY,      ///< %w
+  FORMAT_OP_WEEK_MON,      ///< %W
+  FORMAT_OP_YEAR_2,        ///< %y
+  FORMAT_OP_YEAR,          ///< %Y
+  FORMAT_MAX_OPS
+} FORMAT_OPS;
+
+#define FULL_NAME_LENGTH (9U) ///< Letters of the longest weak day and month
+#define HALF_DAY_HOURS (12U)  ///< Hours of the 12 hour clock
+
+/**
+ * @brief The full names of the weak days
+ *
+ */
+static const char weakDayFullNames[TINY_MAX_WEAKDAYS][FULL_NAME_LENGTH + 1] = {
+    [TINY_SUN] = "Sunday",   [TINY_MON] = "Monday", [TINY_TUE] = "Tuesday",
+    [TINY_WED] = "Wednesday", [TINY_THU] = "Thursday", [TINY_FRI] = "Friday",
+    [TINY_SAT] = "Saturday"};
+
+/**
+ * @brief The full names of the months
+ *
+ */
+static const char monthFullNames[TINY_MAX_MONTHS - TINY_JAN]
+                                [FULL_NAME_LENGTH + 1] = {
+    [TINY_JAN - TINY_JAN] = "January",   [TINY_FEB - TINY_JAN] = "February",
+    [TINY_MAR - TINY_JAN] = "March",     [TINY_APR - TINY_JAN] = "April",
+    [TINY_MAY - TINY_JAN] = "May",       [TINY_JUN - TINY_JAN] = "June",
+    [TINY_JUL - TINY_JAN] = "July",      [TINY_AUG - TINY_JAN] = "August",
+    [TINY_SEP - TINY_JAN] = "September", [TINY_OCT - TINY_JAN] = "October",
+    [TINY_NOV - TINY_JAN] = "November",  [TINY_DEC - TINY_JAN] = "December"};
+
+/**
+ * @brief The longest output of every format operation except literals
+ *
+ */
+static const uint8_t formatOpLengths[FORMAT_MAX_OPS] = {
+    [FORMAT_OP_LITERAL] = 0,        [FORMAT_OP_WEAK_DAY_NAME] = NAME_LENGTH,
+    [FORMAT_OP_WEAK_DAY_FULL] = FULL_NAME_LENGTH,
+    [FORMAT_OP_MONTH_NAME] = NAME_LENGTH,
+    [FORMAT_OP_MONTH_FULL] = FULL_NAME_LENGTH,
+    [FORMAT_OP_CENTURY] = 3,        [FORMAT_OP_MONTH_DAY] = 3,
+    [FORMAT_OP_MONTH_DAY_PAD] = 3,  [FORMAT_OP_HOUR] = 3,
+    [FORMAT_OP_HOUR_12] = 2,        [FORMAT_OP_YEAR_DAY] = 5,
+    [FORMAT_OP_MONTH] = 3,          [FORMAT_OP_MIN] = 3,
+    [FORMAT_OP_AM_PM] = 2,          [FORMAT_OP_SEC] = 3,
+    [FORMAT_OP_WEAK_DAY_MON] = 3,   [FORMAT_OP_WEEK_SUN] = 4,
+    [FORMAT_OP_WEAK_DAY] = 3,       [FORMAT_OP_WEEK_MON] = 4,
+    [FORMAT_OP_YEAR_2] = 2,         [FORMAT_OP_YEAR] = 5};
+
+/**
+ * @brief The output length of every format operation for the times of
+ * tiny_getTimeType until the year 9999, 0 for literals and full names
+ *
+ */
+static const uint8_t formatOpFixedLengths[FORMAT_MAX_OPS] = {
+    [FORMAT_OP_LITERAL] = 0,        [FORMAT_OP_WEAK_DAY_NAME] = NAME_LENGTH,
+    [FORMAT_OP_WEAK_DAY_FULL] = 0,  [FORMAT_OP_MONTH_NAME] = NAME_LENGTH,
+    [FORMAT_OP_MONTH_FULL] = 0,     [FORMAT_OP_CENTURY] = 2,
+    [FORMAT_OP_MONTH_DAY] = 2,      [FORMAT_OP_MONTH_DAY_PAD] = 2,
+    [FORMAT_OP_HOUR] = 2,           [FORMAT_OP_HOUR_12] = 2,
+    [FORMAT_OP_YEAR_DAY] = 3,       [FORMAT_OP_MONTH] = 2,
+    [FORMAT_OP_MIN] = 2,            [FORMAT_OP_AM_PM] = 2,
+    [FORMAT_OP_SEC] = 2,            [FORMAT_OP_WEAK_DAY_MON] = 1,
+    [FORMAT_OP_WEEK_SUN] = 2,       [FORMAT_OP_WEAK_DAY] = 1,
+    [FORMAT_OP_WEEK_MON] = 2,       [FORMAT_OP_YEAR_2] = 2,
+    [FORMAT_OP_YEAR] = 4};
+
+/**
+ * @brief Writes a value with at least two digits.
+ *
+ * @param dst The buffer to write to
+ * @param value The value to write
+ * @param pad The character to fill up values below 10
+ * @return char* The end of the written number
+ */
+static inline char *tiny_writePair(char *dst, const uint16_t value,
+                                   const char pad)
+{
+  if (IS_BIGGER(value, MAX_DIGIT_PAIR)) {
+    return tiny_writeDecimal(dst, value, 2, pad);
+  }
+  memcpy(dst, DIGIT_PAIR(value), 2);
+  if (value < DECIMAL_BASE) {
+    dst[0] = pad;
+  }
+  return dst + 2;
+}
+
+/**
+ * @brief Returns the week of the year with weeks starting at a weak day.
+ *
+ * Days before the first of these weak days are in week 0.
+ *
+ * @param tm The time with a yearDay starting at 1
+ * @param firstWeakDay The first weak day of a week
+ * @return uint16_t The week of the year
+ */
+static inline uint16_t tiny_getYearWeek(const tinyTimeType *tm,
+                                        const uint8_t firstWeakDay)
+{
+  return (uint16_t)((tm->yearDay + TINY_SAT -
+                     (tm->weakDay + TINY_MAX_WEAKDAYS - firstWeakDay) %
+                         TINY_MAX_WEAKDAYS) /
+                    TINY_MAX_WEAKDAYS);
+}
+
+/**
+ * @brief Appends an operation to a format program.
+ *
+ * @param prog The program to append to
+ * @param op The operation code
+ * @param length The longest output of the operation
+ * @return uint8_t 1 if appended, 0 if the program limits are exceeded
+ */
+static uint8_t tiny_appendFormatOp(tinyFormatProgramType *prog,
+                                   const FORMAT_OPS op,
+                                   const uint8_t length)
+{
+  if (IS_BIGGER(prog->opCount + 1U, TINY_FORMAT_PROGRAM_OPS) ||
+      IS_BIGGER(prog->maxLength + length, TINY_FORMAT_PROGRAM_LENGTH)) {
+    return 0;
+  }
+  prog->ops[prog->opCount] = (uint8_t)op;
+  prog->args[prog->opCount] = 0;
+  prog->opCount++;
+  prog->maxLength = (uint8_t)(prog->maxLength + length);
+  return 1;
+}
+
+/**
+ * @brief Appends a literal character to a format program.
+ *
+ * The character is merged into a directly preceding literal operation.
+ *
+ * @param prog The program to append to
+ * @param letter The literal character
+ * @return uint8_t 1 if appended, 0 if the program limits are exceeded
+ */
+static uint8_t tiny_appendFormatLiteral(tinyFormatProgramType *prog,
+                                        const char letter)
+{
+  if (IS_BIGGER(prog->literalCount + 1U, TINY_FORMAT_PROGRAM_LITERALS)) {
+    return 0;
+  }
+  if (0 == prog->opCount ||
+      FORMAT_OP_LITERAL != prog->ops[prog->opCount - 1U]) {
+    if (!tiny_appendFormatOp(prog, FORMAT_OP_LITERAL, 0)) {
+      return 0;
+    }
+  }
+  if (IS_BIGGER(prog->maxLength + 1U, TINY_FORMAT_PROGRAM_LENGTH)) {
+    return 0;
+  }
+  prog->literals[prog->literalCount++] = letter;
+  prog->args[prog->opCount - 1U]++;
+  prog->maxLength++;
+  return 1;
+}
+
+/**
+ * @brief Compiles a pattern into the operations of a format program.
+ *
+ * Composite conversions like %F are compiled from their expanded pattern.
+ *
+ * @param prog The program to append to
+ * @param pattern The C-string of the pattern
+ * @return uint8_t 1 if compiled, 0 in case of unsupported conversions or
+ * exceeded program limits
+ */
+static uint8_t tiny_compileFormatPattern(tinyFormatProgramType *prog,
+                                         const char *pattern)
+{
+  for (; '\0' != *pattern; pattern++) {
+    if ('%' != *pattern) {
+      if (!tiny_appendFormatLiteral(prog, *pattern)) {
+        return 0;
+      }
+      continue;
+    }
+    pattern++;
+    const char *expansion = NULL;
+    char letter = '\0';
+    FORMAT_OPS op = FORMAT_OP_LITERAL;
+    switch (*pattern) {
+    case 'a':
+      op = FORMAT_OP_WEAK_DAY_NAME;
+      break;
+    case 'A':
+      op = FORMAT_OP_WEAK_DAY_FULL;
+      break;
+    case 'b':
+    case 'h':
+      op = FORMAT_OP_MONTH_NAME;
+      break;
+    case 'B':
+      op = FORMAT_OP_MONTH_FULL;
+      break;
+    case 'C':
+      op = FORMAT_OP_CENTURY;
+      break;
+    case 'd':
+      op = FORMAT_OP_MONTH_DAY;
+      break;
+    case 'e':
+      op = FORMAT_OP_MONTH_DAY_PAD;
+      break;
+    case 'H':
+      op = FORMAT_OP_HOUR;
+      break;
+    case 'I':
+      op = FORMAT_OP_HOUR_12;
+      break;
+    case 'j':
+      op = FORMAT_OP_YEAR_DAY;
+      break;
+    case 'm':
+      op = FORMAT_OP_MONTH;
+      break;
+    case 'M':
+      op = FORMAT_OP_MIN;
+      break;
+    case 'p':
+      op = FORMAT_OP_AM_PM;
+      break;
+    case 'S':
+      op = FORMAT_OP_SEC;
+      break;
+    case 'u':
+      op = FORMAT_OP_WEAK_DAY_MON;
+      break;
+    case 'U':
+      op = FORMAT_OP_WEEK_SUN;
+      break;
+    case 'w':
+      op = FORMAT_OP_WEAK_DAY;
+      break;
+    case 'W':
+      op = FORMAT_OP_WEEK_MON;
+      break;
+    case 'y':
+      op = FORMAT_OP_YEAR_2;
+      break;
+    case 'Y':
+      op = FORMAT_OP_YEAR;
+      break;
+    case 'c':
+      expansion = "%a %b %e %H:%M:%S %Y";
+      break;
+    case 'D':
+    case 'x':
+      expansion = "%m/%d/%y";
+      break;
+    case 'F':
+      expansion = "%Y-%m-%d";
+      break;
+    case 'R':
+      expansion = "%H:%M";
+      break;
+    case 'T':
+    case 'X':
+      expansion = "%H:%M:%S";
+      break;
+    case 'n':
+      letter = '\n';
+      break;
+    case 't':
+      letter = '\t';
+      break;
+    case '%':
+      letter = '%';
+      break;
+    default:
+      return 0;
+    }
+    uint8_t compiled;
+    if (NULL != expansion) {
+      compiled = tiny_compileFormatPattern(prog, expansion);
+    } else if ('\0' != letter) {
+      compiled = tiny_appendFormatLiteral(prog, letter);
+    } else {
+      compiled = tiny_appendFormatOp(prog, op, formatOpLengths[op]);
+    }
+    if (!compiled) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+uint8_t tiny_formatCompile(tinyFormatProgramType *prog, const char *pattern)
+{
+  if (NULL == prog) {
+    return 0;
+  }
+  prog->opCount = 0;
+  prog->literalCount = 0;
+  prog->maxLength = 0;
+  prog->fixedLength = 0;
+  if (NULL == pattern) {
+    return 0;
+  }
+  if (!tiny_compileFormatPattern(prog, pattern)) {
+    // Never run a partly compiled program
+    prog->opCount = 0;
+    prog->literalCount = 0;
+    prog->maxLength = 0;
+    return 0;
+  }
+  // Full names have no fixed length
+  uint8_t fixedLength = prog->literalCount;
+  for (uint8_t i = 0; i < prog->opCount; i++) {
+    if (FORMAT_OP_LITERAL != prog->ops[i] &&
+        0 == formatOpFixedLengths[prog->ops[i]]) {
+      return 1;
+    }
+    fixedLength = (uint8_t)(fixedLength + formatOpFixedLengths[prog->ops[i]]);
+  }
+  prog->fixedLength = fixedLength;
+  return 1;
+}
+
+/**
+ * @brief Executes the operations of a format program.
+ *
+ * @param prog The compiled program
+ * @param tm The time to format
+ * @param dst The buffer of at least prog->maxLength + 1 bytes
+ * @return size_t The length of the string without the null terminator
+ */
+static size_t tiny_runFormatProgram(const tinyFormatProgramType *prog,
+                                    const tinyTimeType *tm,
+                                    char *dst)
+{
+  const char *literal = prog->literals;
+  char *end = dst;
+  for (uint8_t i = 0; i < prog->opCount; i++) {
+    switch ((FORMAT_OPS)prog->ops[i]) {
+    case FORMAT_OP_LITERAL:
+      // Mostly single separators, cheaper than a memcpy call
+      for (uint8_t j = 0; j < prog->args[i]; j++) {
+        *end++ = *literal++;
+      }
+      break;
+    case FORMAT_OP_WEAK_DAY_NAME:
+      if (IS_BIGGER(tm->weakDay, TINY_SAT)) {
+        *end++ = '?';
+      } else {
+        end = tiny_writeName(end, weakDayNames[tm->weakDay]);
+      }
+      break;
+    case FORMAT_OP_WEAK_DAY_FULL:
+      if (IS_BIGGER(tm->weakDay, TINY_SAT)) {
+        *end++ = '?';
+      } else {
+        // Copy the whole name slot, the length only moves the end
+        memcpy(end, weakDayFullNames[tm->weakDay], FULL_NAME_LENGTH);
+        end += strlen(weakDayFullNames[tm->weakDay]);
+      }
+      break;
+    case FORMAT_OP_MONTH_NAME:
+      if (IS_NOT_IN_RANGE(tm->month, TINY_JAN, TINY_DEC)) {
+        *end++ = '?';
+      } else {
+        end = tiny_writeName(end, monthNames[tm->month - TINY_JAN]);
+      }
+      break;
+    case FORMAT_OP_MONTH_FULL:
+      if (IS_NOT_IN_RANGE(tm->month, TINY_JAN, TINY_DEC)) {
+        *end++ = '?';
+      } else {
+        memcpy(end, monthFullNames[tm->month - TINY_JAN], FULL_NAME_LENGTH);
+        end += strlen(monthFullNames[tm->month - TINY_JAN]);
+      }
+      break;
+    case FORMAT_OP_CENTURY:
+      end = tiny_writePair(end, (uint16_t)(tm->year / DIGIT_PAIRS), '0');
+      break;
+    case FORMAT_OP_MONTH_DAY:
+      end = tiny_writePair(end, tm->monthDay, '0');
+      break;
+    case FORMAT_OP_MONTH_DAY_PAD:
+      end = tiny_writePair(end, tm->monthDay, ' ');
+      break;
+    case FORMAT_OP_HOUR:
+      end = tiny_writePair(end, tm->hour, '0');
+      break;
+    case FORMAT_OP_HOUR_12: {
+      const uint8_t hour = (uint8_t)(tm->hour % HALF_DAY_HOURS);
+      end = tiny_writePair(end, hour ? hour : HALF_DAY_HOURS, '0');
+      break;
+    }
+    case FORMAT_OP_YEAR_DAY:
+      end = tiny_writeDecimal(end, tm->yearDay, 3, '0');
+      break;
+    case FORMAT_OP_MONTH:
+      end = tiny_writePair(end, tm->month, '0');
+      break;
+    case FORMAT_OP_MIN:
+      end = tiny_writePair(end, tm->min, '0');
+      break;
+    case FORMAT_OP_AM_PM:
+      end[0] = IS_SMALLER(tm->hour, HALF_DAY_HOURS)
+                   ? 'A'
+                   : 'P';
+      end[1] = 'M';
+      end += 2;
+      break;
+    case FORMAT_OP_SEC:
+      end = tiny_writePair(end, tm->sec, '0');
+      break;
+    case FORMAT_OP_WEAK_DAY_MON:
+      end = tiny_writeDecimal(
+          end, tm->weakDay ? tm->weakDay : TINY_MAX_WEAKDAYS, 1, '0');
+      break;
+    case FORMAT_OP_WEEK_SUN:
+      end = tiny_writePair(end, tiny_getYearWeek(tm, TINY_SUN), '0');
+      break;
+    case FORMAT_OP_WEAK_DAY:
+      end = tiny_writeDecimal(end, tm->weakDay, 1, '0');
+      break;
+    case FORMAT_OP_WEEK_MON:
+      end = tiny_writePair(end, tiny_getYearWeek(tm, TINY_MON), '0');
+      break;
+    case FORMAT_OP_YEAR_2:
+      memcpy(end, DIGIT_PAIR(tm->year % DIGIT_PAIRS), 2);
+      end += 2;
+      break;
+    case FORMAT_OP_YEAR:
+      if (IS_NOT_IN_RANGE(tm->year, MIN_FOUR_DIGITS, MAX_FOUR_DIGITS)) {
+        end = tiny_writeDecimal(end, tm->year, 1, '0');
+        break;
+      }
+      memcpy(end, DIGIT_PAIR(tm->year / DIGIT_PAIRS), 2);
+      memcpy(&end[2], DIGIT_PAIR(tm->year % DIGIT_PAIRS), 2);
+      end += 4;
+      break;
+    default:
+      break;
+    }
+  }
+  *end = '\0';
+  return (size_t)(end - dst);
+}
+
+/**
+ * @brief Returns the output length of a format operation.
+ *
+ * @param op The operation code
+ * @param arg The literal length of the operation
+ * @param tm The time to format
+ * @return uint8_t The length tiny_runFormatProgram writes for the operation
+ */
+static uint8_t tiny_getFormatOpLength(const FORMAT_OPS op,
+                                      const uint8_t arg,
+                                      const tinyTimeType *tm)
+{
+  switch (op) {
+  case FORMAT_OP_LITERAL:
+    return arg;
+  case FORMAT_OP_WEAK_DAY_NAME:
+    return IS_BIGGER(tm->weakDay, TINY_SAT) ? 1U : NAME_LENGTH;
+  case FORMAT_OP_WEAK_DAY_FULL:
+    return IS_BIGGER(tm->weakDay, TINY_SAT)
+               ? 1U
+               : (uint8_t)strlen(weakDayFullNames[tm->weakDay]);
+  case FORMAT_OP_MONTH_NAME:
+    return IS_NOT_IN_RANGE(tm->month, TINY_JAN, TINY_DEC) ? 1U : NAME_LENGTH;
+  case FORMAT_OP_MONTH_FULL:
+    return IS_NOT_IN_RANGE(tm->month, TINY_JAN, TINY_DEC)
+               ? 1U
+               : (uint8_t)strlen(monthFullNames[tm->month - TINY_JAN]);
+  case FORMAT_OP_CENTURY:
+    return tiny_getDecimalLength((uint16_t)(tm->year / DIGIT_PAIRS), 2);
+  case FORMAT_OP_MONTH_DAY:
+  case FORMAT_OP_MONTH_DAY_PAD:
+    return tiny_getDecimalLength(tm->monthDay, 2);
+  case FORMAT_OP_HOUR:
+    return tiny_getDecimalLength(tm->hour, 2);
+  case FORMAT_OP_YEAR_DAY:
+    return tiny_getDecimalLength(tm->yearDay, 3);
+  case FORMAT_OP_MONTH:
+    return tiny_getDecimalLength(tm->month, 2);
+  case FORMAT_OP_MIN:
+    return tiny_getDecimalLength(tm->min, 2);
+  case FORMAT_OP_SEC:
+    return tiny_getDecimalLength(tm->sec, 2);
+  case FORMAT_OP_WEAK_DAY_MON:
+    return tiny_getDecimalLength(tm->weakDay ? tm->weakDay : TINY_MAX_WEAKDAYS,
+                                 1);
+  case FORMAT_OP_WEEK_SUN:
+    return tiny_getDecimalLength(tiny_getYearWeek(tm, TINY_SUN), 2);
+  case FORMAT_OP_WEAK_DAY:
+    return tiny_getDecimalLength(tm->weakDay, 1);
+  case FORMAT_OP_WEEK_MON:
+    return tiny_getDecimalLength(tiny_getYearWeek(tm, TINY_MON), 2);
+  case FORMAT_OP_YEAR:
+    return tiny_getDecimalLength(tm->year, 1);
+  default:
+    // Hour of the 12 hour clock, AM or PM and the two year digits
+    return formatOpLengths[op];
+  }
+}
+
+size_t tiny_formatRun(const tinyFormatProgramType *prog,
+                      const tinyTimeType *tm,
+                      char *buf,
+                      const size_t len)
+{
+  if (NULL == prog || NULL == tm || NULL == buf || 0 == len) {
+    return 0;
+  }
+  // Enough space for the longest output, write directly
+  if (len > prog->maxLength) {
+    return tiny_runFormatProgram(prog, tm, buf);
+  }
+  char formatBuffer[TINY_FORMAT_PROGRAM_LENGTH + 1];
+  const size_t written = tiny_runFormatProgram(prog, tm, formatBuffer);
+  // Do not return truncated strings
+  if (written >= len) {
+    buf[0] = '\0';
+    return 0;
+  }
+  memcpy(buf, formatBuffer, written + 1);
+  return written;
+}
+
+size_t tiny_formatRunLength(const tinyFormatProgramType *prog,
+                            const tinyTimeType *tm)
+{
+  if (NULL == prog || NULL == tm) {
+    return 0;
+  }
+  // Constant time for the time types of unix times until the year 9999
+  if (prog->fixedLength && tiny_isFixedWidth(tm) &&
+      !IS_BIGGER(tm->yearDay, MAX_YEAR_DAY)) {
+    return prog->fixedLength;
+  }
+  size_t length = 0;
+  for (uint8_t i = 0; i < prog->opCount; i++) {
+    length += tiny_getFormatOpLength((FORMAT_OPS)prog->ops[i], prog->args[i], tm);
+  }
+  return length;
+}
+
+/**
+ * @enum PARSE_OPS
+ * @brief Operations of a compiled parse program.
+ *
+ */
+typedef enum {
+  PARSE_OP_LITERAL = 0,   ///< Match literal characters
+  PARSE_OP_WEAK_DAY_NAME, ///< %a
+  PARSE_OP_WEAK_DAY_FULL, ///< %A
+  PARSE_OP_MONTH_NAME,    ///< %b and %h
+  PARSE_OP_MONTH_FULL,    ///< %B
+  PARSE_OP_MONTH_DAY,     ///< %d
+  PARSE_OP_MONTH_DAY_PAD, ///< %e
+  PARSE_OP_HOUR,          ///< %H
+  PARSE_OP_HOUR_12,       ///< %I
+  PARSE_OP_MONTH,         ///< %m
+  PARSE_OP_MIN,           ///< %M
+  PARSE_OP_AM_PM,         ///< %p
+  PARSE_OP_SEC,           ///< %S
+  PARSE_OP_WEAK_DAY_MON,  ///< %u
+  PARSE_OP_WEAK_DAY,      ///< %w
+  PARSE_OP_YEAR_2,        ///< %y
+  PARSE_OP_YEAR,          ///< %Y
+  PARSE_OP_OFFSET,        ///< %z
+  PARSE_MAX_OPS
+} PARSE_OPS;
+
+#define PARSE_OFFSET_HOUR (1U) ///< Offset of the hours in +hhmm
+#define PARSE_OFFSET_MIN (3U)  ///< Offset of the minutes in +hhmm
+#define PARSE_CENTURY_PIVOT (69U) ///< Two digit years below are after 2000
+#define PARSE_YEARS_2000 (2000U)  ///< Century of two digit years below 69
+#define PARSE_YEARS_1900 (1900U)  ///< Century of the other two digit years
+#define PARSE_NO_WEAK_DAY (0xFFU) ///< No weak day in the string
+#define NAME_CASE_BITS (0x202000U) ///< Lower case bits of the name letters 2 and 3
+#define NAME_UPPER_MASK (0xFFFFDFU) ///< Clears the lower case bit of letter 1
+
+/**
+ * @brief The characters every parse operation reads, 0 for literals and the
+ * variable width full names
+ *
+ */
+static const uint8_t parseOpWidths[PARSE_MAX_OPS] = {
+    [PARSE_OP_LITERAL] = 0,        [PARSE_OP_WEAK_DAY_NAME] = NAME_LENGTH,
+    [PARSE_OP_WEAK_DAY_FULL] = 0,  [PARSE_OP_MONTH_NAME] = NAME_LENGTH,
+    [PARSE_OP_MONTH_FULL] = 0,     [PARSE_OP_MONTH_DAY] = 2,
+    [PARSE_OP_MONTH_DAY_PAD] = 2,  [PARSE_OP_HOUR] = 2,
+    [PARSE_OP_HOUR_12] = 2,        [PARSE_OP_MONTH] = 2,
+    [PARSE_OP_MIN] = 2,            [PARSE_OP_AM_PM] = 2,
+    [PARSE_OP_SEC] = 2,            [PARSE_OP_WEAK_DAY_MON] = 1,
+    [PARSE_OP_WEAK_DAY] = 1,       [PARSE_OP_YEAR_2] = 2,
+    [PARSE_OP_YEAR] = 4,           [PARSE_OP_OFFSET] = 5};
+
+/**
+ * @brief Returns the length of the fixed width segment a program appends to.
+ *
+ * A segment starts at the string start or after a full name operation.
+ *
+ * @param prog The program
+ * @return uint8_t* The length of the current segment
+ */
+static uint8_t *tiny_getParseSegment(tinyParseProgramType *prog)
+{
+  for (uint8_t i = prog->opCount; i > 0; i--) {
+    if (0 == parseOpWidths[prog->ops[i - 1U]] &&
+        PARSE_OP_LITERAL != prog->ops[i - 1U]) {
+      return &prog->args[i - 1U];
+    }
+  }
+  return &prog->minLength;
+}
+
+/**
+ * @brief Appends an operation to a parse program.
+ *
+ * @param prog The program to append to
+ * @param op The operation code
+ * @return uint8_t 1 if appended, 0 if the program limits are exceeded
+ */
+static uint8_t tiny_appendParseOp(tinyParseProgramType *prog,
+                                  const PARSE_OPS op)
+{
+  uint8_t *segment = tiny_getParseSegment(prog);
+  if (IS_BIGGER(prog->opCount + 1U, TINY_PARSE_PROGRAM_OPS) ||
+      IS_BIGGER(*segment + parseOpWidths[op], TINY_PARSE_PROGRAM_LENGTH)) {
+    return 0;
+  }
+  prog->ops[prog->opCount] = (uint8_t)op;
+  prog->offsets[prog->opCount] = *segment;
+  prog->args[prog->opCount] = 0;
+  prog->opCount++;
+  *segment = (uint8_t)(*segment + parseOpWidths[op]);
+  return 1;
+}
+
+/**
+ * @brief Appends a literal character to a parse program.
+ *
+ * The character is merged into a directly preceding literal operation.
+ *
+ * @param prog The program to append to
+ * @param letter The literal character
+ * @return uint8_t 1 if appended, 0 if the program limits are exceeded
+ */
+static uint8_t tiny_appendParseLiteral(tinyParseProgramType *prog,
+                                       const char letter)
+{
+  if (IS_BIGGER(prog->literalCount + 1U, TINY_PARSE_PROGRAM_LITERALS)) {
+    return 0;
+  }
+  if (0 == prog->opCount ||
+      PARSE_OP_LITERAL != prog->ops[prog->opCount - 1U]) {
+    if (!tiny_appendParseOp(prog, PARSE_OP_LITERAL)) {
+      return 0;
+    }
+  }
+  uint8_t *segment = tiny_getParseSegment(prog);
+  if (IS_BIGGER(*segment + 1U, TINY_PARSE_PROGRAM_LENGTH)) {
+    return 0;
+  }
+  prog->literals[prog->literalCount++] = letter;
+  prog->args[prog->opCount - 1U]++;
+  (*segment)++;
+  return 1;
+}
+
+/**
+ * @brief Compiles a pattern into the operations of a parse program.
+ *
+ * Composite conversions like %F are compiled from their expanded pattern.
+ *
+ * @param prog The program to append to
+ * @param pattern The C-string of the pattern
+ * @return uint8_t 1 if compiled, 0 in case of unsupported conversions or
+ * exceeded program limits
+ */
+static uint8_t tiny_compileParsePattern(tinyParseProgramType *prog,
+                                        const char *pattern)
+{
+  for (; '\0' != *pattern; pattern++) {
+    if ('%' != *pattern) {
+      if (!tiny_appendParseLiteral(prog, *pattern)) {
+        return 0;
+      }
+      continue;
+    }
+    pattern++;
+    const char *expansion = NULL;
+    char letter = '\0';
+    PARSE_OPS op = PARSE_OP_LITERAL;
+    switch (*pattern) {
+    case 'a':
+      op = PARSE_OP_WEAK_DAY_NAME;
+      break;
+    case 'A':
+      op = PARSE_OP_WEAK_DAY_FULL;
+      break;
+    case 'b':
+    case 'h':
+      op = PARSE_OP_MONTH_NAME;
+      break;
+    case 'B':
+      op = PARSE_OP_MONTH_FULL;
+      break;
+    case 'd':
+      op = PARSE_OP_MONTH_DAY;
+      break;
+    case 'e':
+      op = PARSE_OP_MONTH_DAY_PAD;
+      break;
+    case 'H':
+      op = PARSE_OP_HOUR;
+      break;
+    case 'I':
+      op = PARSE_OP_HOUR_12;
+      break;
+    case 'm':
+      op = PARSE_OP_MONTH;
+      break;
+    case 'M':
+      op = PARSE_OP_MIN;
+      break;
+    case 'p':
+      op = PARSE_OP_AM_PM;
+      break;
+    case 'S':
+      op = PARSE_OP_SEC;
+      break;
+    case 'u':
+      op = PARSE_OP_WEAK_DAY_MON;
+      break;
+    case 'w':
+      op = PARSE_OP_WEAK_DAY;
+      break;
+    case 'y':
+      op = PARSE_OP_YEAR_2;
+      break;
+    case 'Y':
+      op = PARSE_OP_YEAR;
+      break;
+    case 'z':
+      op = PARSE_OP_OFFSET;
+      break;
+    case 'c':
+      expansion = "%a %b %e %H:%M:%S %Y";
+      break;
+    case 'D':
+    case 'x':
+      expansion = "%m/%d/%y";
+      break;
+    case 'F':
+      expansion = "%Y-%m-%d";
+      break;
+    case 'R':
+      expansion = "%H:%M";
+      break;
+    case 'T':
+    case 'X':
+      expansion = "%H:%M:%S";
+      break;
+    case 'n':
+      letter = '\n';
+      break;
+    case 't':
+      letter = '\t';
+      break;
+    case '%':
+      letter = '%';
+      break;
+    default:
+      return 0;
+    }
+    uint8_t compiled;
+    if (NULL != expansion) {
+      compiled = tiny_compileParsePattern(prog, expansion);
+    } else if ('\0' != letter) {
+      compiled = tiny_appendParseLiteral(prog, letter);
+    } else {
+      compiled = tiny_appendParseOp(prog, op);
+    }
+    if (!compiled) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+uint8_t tiny_parseCompile(tinyParseProgramType *prog, const char *pattern)
+{
+  if (NULL == prog) {
+    return 0;
+  }
+  prog->opCount = 0;
+  prog->literalCount = 0;
+  prog->minLength = 0;
+  prog->tailLength = 0;
+  if (NULL == pattern) {
+    return 0;
+  }
+  if ('\0' == *pattern || !tiny_compileParsePattern(prog, pattern)) {
+    // Never run a partly compiled program
+    prog->opCount = 0;
+    prog->literalCount = 0;
+    prog->minLength = 0;
+    return 0;
+  }
+  prog->tailLength = *tiny_getParseSegment(prog);
+  return 1;
+}
+
+/**
+ * @brief Reads a three letter name in any case.
+ *
+ * @param src The three letters
+ * @return uint32_t The letters packed like NAME_WORD with the case of the
+ * name tables, the first letter upper and the others lower case
+ */
+static inline uint32_t tiny_loadName(const char *src)
+{
+  return ((uint32_t)NAME_WORD((uint8_t)src[0], (uint8_t)src[1],
+                              (uint8_t)src[2]) |
+          NAME_CASE_BITS) &
+         NAME_UPPER_MASK;
+}
+
+/**
+ * @brief Matches the letters after the first three of a full name.
+ *
+ * @param src The characters after the first three letters
+ * @param len The number of characters
+ * @param name The full name
+ * @return size_t The length of the full name or 0 if it does not match
+ */
+static size_t tiny_matchFullName(const char *src,
+                                 const size_t len,
+                                 const char *name)
+{
+  const size_t nameLength = strlen(name);
+  if (IS_SMALLER(len + NAME_LENGTH, nameLength)) {
+    return 0;
+  }
+  for (size_t i = NAME_LENGTH; i < nameLength; i++) {
+    if ((char)(src[i - NAME_LENGTH] | ASCII_LOWER_CASE) != name[i]) {
+      return 0;
+    }
+  }
+  return nameLength;
+}
+
+size_t tiny_parseRun(const tinyParseProgramType *prog,
+                     const char *str,
+                     const size_t len,
+                     tinyTimeType *tm)
+{
+  if (NULL == prog || NULL == str || NULL == tm || 0 == prog->opCount ||
+      IS_SMALLER(len, prog->minLength)) {
+    return 0;
+  }
+
+  // Fields missing in the pattern are taken from 1.1.1970 00:00:00
+  uint16_t year = TINY_UNIX_YEAR_BEGIN;
+  uint8_t month = TINY_JAN;
+  uint8_t monthDay = MONTH_DAY_OFFSET;
+  uint8_t hour = 0;
+  uint8_t min = 0;
+  uint8_t sec = 0;
+  uint8_t value = 0;
+  uint8_t isHour12 = 0;
+  uint8_t isPm = 0;
+  uint8_t weakDay = PARSE_NO_WEAK_DAY;
+  int32_t offset = 0;
+  uint8_t isInvalid = 0;
+
+  // Fixed width fields are read at constant offsets from the base, only the
+  // full names move it
+  const char *base = str;
+  const char *literal = prog->literals;
+  for (uint8_t i = 0; i < prog->opCount; i++) {
+    const char *src = &base[prog->offsets[i]];
+    switch ((PARSE_OPS)prog->ops[i]) {
+    case PARSE_OP_LITERAL:
+      // Mostly single separators, cheaper than a memcmp call
+      for (uint8_t j = 0; j < prog->args[i]; j++) {
+        isInvalid |= (uint8_t)(src[j] != *literal++);
+      }
+      break;
+    case PARSE_OP_WEAK_DAY_NAME: {
+      const uint32_t word = tiny_loadName(src);
+      weakDay = weakDayHashes[(word * WEAK_DAY_HASH_MAGIC) >>
+                              WEAK_DAY_HASH_SHIFT];
+      isInvalid |= (uint8_t)((uint32_t)weakDayNameWords[weakDay] != word);
+      break;
+    }
+    case PARSE_OP_MONTH_NAME: {
+      const uint32_t word = tiny_loadName(src);
+      month = tiny_hashMonthName(word);
+      isInvalid |= (uint8_t)((uint32_t)monthNameWords[month - TINY_JAN] != word);
+      break;
+    }
+    case PARSE_OP_WEAK_DAY_FULL:
+    case PARSE_OP_MONTH_FULL: {
+      // The name and the following fixed width segment must fit
+      const size_t rest = len - (size_t)(src - str);
+      if (IS_SMALLER(rest, NAME_LENGTH)) {
+        return 0;
+      }
+      const uint32_t word = tiny_loadName(src);
+      const char *name;
+      if (PARSE_OP_MONTH_FULL == prog->ops[i]) {
+        month = tiny_hashMonthName(word);
+        isInvalid |=
+            (uint8_t)((uint32_t)monthNameWords[month - TINY_JAN] != word);
+        name = monthFullNames[month - TINY_JAN];
+      } else {
+        weakDay = weakDayHashes[(word * WEAK_DAY_HASH_MAGIC) >>
+                                WEAK_DAY_HASH_SHIFT];
+        isInvalid |= (uint8_t)((uint32_t)weakDayNameWords[weakDay] != word);
+        name = weakDayFullNames[weakDay];
+      }
+      const size_t nameLength = tiny_matchFullName(
+          &src[NAME_LENGTH], rest - NAME_LENGTH, name);
+      if (isInvalid || 0 == nameLength ||
+          IS_SMALLER(rest - nameLength, prog->args[i])) {
+        return 0;
+      }
+      base = src + nameLength;
+      break;
+    }
+    case PARSE_OP_MONTH_DAY:
+      isInvalid |= (uint8_t)!tiny_readDigitPair(src, &monthDay);
+      break;
+    case PARSE_OP_MONTH_DAY_PAD: {
+      const char pair[2] = {' ' == src[0] ? '0' : src[0], src[1]};
+      isInvalid |= (uint8_t)!tiny_readDigitPair(pair, &monthDay);
+      break;
+    }
+    case PARSE_OP_HOUR:
+      isInvalid |= (uint8_t)!tiny_readDigitPair(src, &hour);
+      break;
+    case PARSE_OP_HOUR_12:
+      isInvalid |= (uint8_t)(!tiny_readDigitPair(src, &hour) |
+                             IS_NOT_IN_RANGE(hour, 1U, HALF_DAY_HOURS));
+      isHour12 = 1;
+      break;
+    case PARSE_OP_MONTH:
+      isInvalid |= (uint8_t)!tiny_readDigitPair(src, &month);
+      break;
+    case PARSE_OP_MIN:
+      isInvalid |= (uint8_t)!tiny_readDigitPair(src, &min);
+      break;
+    case PARSE_OP_AM_PM: {
+      const char half = (char)(src[0] | ASCII_LOWER_CASE);
+      isPm = (uint8_t)('p' == half);
+      isInvalid |= (uint8_t)((('a' != half) & !isPm) |
+                             ('m' != (src[1] | ASCII_LOWER_CASE)));
+      break;
+    }
+    case PARSE_OP_SEC:
+      isInvalid |= (uint8_t)!tiny_readDigitPair(src, &sec);
+      break;
+    case PARSE_OP_WEAK_DAY_MON:
+      // Monday is 1 and sunday 7
+      weakDay = (uint8_t)((uint8_t)(src[0] - '0') % TINY_MAX_WEAKDAYS);
+      isInvalid |= (uint8_t)IS_NOT_IN_RANGE(src[0], '1', '7');
+      break;
+    case PARSE_OP_WEAK_DAY:
+      weakDay = (uint8_t)(src[0] - '0');
+      isInvalid |= (uint8_t)IS_NOT_IN_RANGE(src[0], '0', '6');
+      break;
+    case PARSE_OP_YEAR_2:
+      isInvalid |= (uint8_t)!tiny_readDigitPair(src, &value);
+      year = (uint16_t)(value + (IS_SMALLER(value, PARSE_CENTURY_PIVOT)
+                                     ? PARSE_YEARS_2000
+                                     : PARSE_YEARS_1900));
+      break;
+    case PARSE_OP_YEAR: {
+      uint8_t century = 0;
+      isInvalid |= (uint8_t)(!tiny_readDigitPair(src, &century) |
+                             !tiny_readDigitPair(&src[2], &value));
+      year = (uint16_t)(century * DIGIT_PAIRS + value);
+      break;
+    }
+    case PARSE_OP_OFFSET: {
+      uint8_t offsetHour = 0;
+      isInvalid |= (uint8_t)(
+          (('+' != src[0]) & ('-' != src[0])) |
+          !tiny_readDigitPair(&src[PARSE_OFFSET_HOUR], &offsetHour) |
+          !tiny_readDigitPair(&src[PARSE_OFFSET_MIN], &value) |
+          IS_BIGGER(offsetHour, TINY_HOUR_MAX) |
+          IS_BIGGER(value, TINY_MINUTE_MAX));
+      offset = (offsetHour * TINY_ONE_MIN_IN_SEC + value) *
+               TINY_ONE_MIN_IN_SEC;
+      offset = '-' == src[0] ? -offset : offset;
+      break;
+    }
+    default:
+      break;
+    }
+  }
+  if (isInvalid) {
+    return 0;
+  }
+  if (isHour12) {
+    hour = (uint8_t)(hour % HALF_DAY_HOURS + isPm * HALF_DAY_HOURS);
+  }
+
+  // Same validation as tiny_getUnixTime, the weak day has to match the date
+  if (IS_BIGGER(sec, TINY_SEC_MAX) | IS_BIGGER(min, TINY_MINUTE_MAX) |
+      IS_BIGGER(hour, TINY_HOUR_MAX) | IS_SMALLER(year, TINY_UNIX_YEAR_BEGIN) |
+      IS_NOT_IN_RANGE(monthDay, MONTH_DAY_OFFSET,
+                      tiny_getMonthDays(year, month))) {
+    return 0;
+  }
+  const uint16_t yearDay = tiny_getYearDay(year, month, monthDay);
+  const uint32_t days = tiny_yearToDays(year) + yearDay - MONTH_DAY_OFFSET;
+  const uint8_t dateWeakDay = (uint8_t)((days + TINY_THU) % TINY_MAX_WEAKDAYS);
+  const tinyUnixType localTime = days * (tinyUnixType)TINY_ONE_DAY_IN_SEC +
+                                 hour * TINY_ONE_HOUR_IN_SEC +
+                                 min * TINY_ONE_MIN_IN_SEC + sec;
+  if ((PARSE_NO_WEAK_DAY != weakDay && dateWeakDay != weakDay) ||
+      (0 < offset && IS_SMALLER(localTime, (tinyUnixType)offset))) {
+    return 0;
+  }
+  if (0 != offset) {
+    // The UTC time of the offset, must not be before the unix epoch
+    tiny_toTimeType(tm, localTime - (tinyUnixType)(int64_t)offset);
+  } else {
+    tm->sec = sec;
+    tm->min = min;
+    tm->hour = hour;
+    tm->monthDay = monthDay;
+    tm->month = month;
+    tm->year = year;
+    tm->weakDay = dateWeakDay;
+    tm->yearDay = yearDay;
+  }
+  return (size_t)(base - str) + prog->tailLength;
 }
 
 uint8_t tiny_isLeapYear(const uint16_t year)
 {
-  return (
-      0 == (year % LEAP_YEAR_FREQUENCY) &&
-      (year % LEAP_YEAR_REMOVED != 0 || 0 == (year) % LEAP_YEAR_CORRECTION));
+  return (uint8_t)(
+      (0 == (year % LEAP_YEAR_FREQUENCY)) &
+      ((year % LEAP_YEAR_REMOVED != 0) | (0 == (year) % LEAP_YEAR_CORRECTION)));
 }
 
 uint8_t tiny_getMonthDays(const uint16_t year, const uint8_t month)
@@ -179,13 +4683,6 @@ uint8_t tiny_getMonthDays(const uint16_t year, const uint8_t month)
   if (IS_NOT_IN_RANGE(month, TINY_JAN, TINY_DEC)) {
     return 0;
   }
-  static const uint8_t daysPerMonth[TINY_MAX_MONTHS - TINY_JAN] = {
-      [TINY_JAN - TINY_JAN] = 31, [TINY_FEB - TINY_JAN] = 28,
-      [TINY_MAR - TINY_JAN] = 31, [TINY_APR - TINY_JAN] = 30,
-      [TINY_MAY - TINY_JAN] = 31, [TINY_JUN - TINY_JAN] = 30,
-      [TINY_JUL - TINY_JAN] = 31, [TINY_AUG - TINY_JAN] = 31,
-      [TINY_SEP - TINY_JAN] = 30, [TINY_OCT - TINY_JAN] = 31,
-      [TINY_NOV - TINY_JAN] = 30, [TINY_DEC - TINY_JAN] = 31};
   if (month == TINY_FEB) {
     // Check leap year and return
     return daysPerMonth[month - TINY_JAN] + tiny_isLeapYear(year);
@@ -199,20 +4696,21 @@ uint64_t tiny_convertSeconds(const uint64_t seconds,
                              uint64_t *mins)
 {
   uint64_t remainingSeconds = seconds;
+  uint32_t remainder;
   // Check days if passed
   if (days) {
-    *days = (remainingSeconds / TINY_ONE_DAY_IN_SEC);
-    remainingSeconds %= TINY_ONE_DAY_IN_SEC;
+    *days = tiny_divide(remainingSeconds, DAY_DIVISOR, &remainder);
+    remainingSeconds = remainder;
   }
   // check hour if passed
   if (hours) {
-    *hours = remainingSeconds / TINY_ONE_HOUR_IN_SEC;
-    remainingSeconds %= TINY_ONE_HOUR_IN_SEC;
+    *hours = tiny_divide(remainingSeconds, HOUR_DIVISOR, &remainder);
+    remainingSeconds = remainder;
   }
   // Check minutes if passed
   if (mins) {
-    *mins = remainingSeconds / TINY_ONE_MIN_IN_SEC;
-    remainingSeconds %= TINY_ONE_MIN_IN_SEC;
+    *mins = tiny_divide(remainingSeconds, MIN_DIVISOR, &remainder);
+    remainingSeconds = remainder;
   }
   // return the remaining seconds
   return remainingSeconds;
@@ -0,0 +1,701 @@
+/**
+ * @file bench_tinyTimeLib.c
+ * @author Adrian STEINER (steia19@bfh.ch)
+ * @brief Throughput benchmarks of the tinytime lib conversions
+ * @version 0.1
+ * @date 16-10-2026
+ *
+ * @copyright (C) 2025 Adrian STEINER
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https: //www.gnu.org/licenses/>.
+ *
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include "tinytime.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_ELEMENTS (1U << 16) ///< Elements per benchmark round
+#define BENCH_ROUNDS (64U)        ///< Rounds per benchmark
+#define BENCH_MAX_UNIX ((tinyUnixType)4102444800) ///< 1.1.2100
+#define BENCH_LEVEL_PASSES (4U)      ///< Interleaved passes of SIMD level benchmarks
+#define BENCH_LEVEL_TOLERANCE (1.1)  ///< Allowed slowdown of a higher SIMD level
+
+static tinyUnixType unixTimes[BENCH_ELEMENTS];
+static tinyUnixType unixResults[BENCH_ELEMENTS];
+static tinyTimeType timeTypes[BENCH_ELEMENTS];
+static uint8_t invalidMap[(BENCH_ELEMENTS + 7) / 8];
+static volatile uint64_t benchSink;
+static const char *columnLevelNames[TINY_MAX_SIMD_LEVELS] = {
+    [TINY_SIMD_NONE] = "tiny_getUnixTimeColumns (scalar)",
+    [TINY_SIMD_SSE41] = "tiny_getUnixTimeColumns (SSE4.1)",
+    [TINY_SIMD_AVX2] = "tiny_getUnixTimeColumns (AVX2)",
+    [TINY_SIMD_AVX512] = "tiny_getUnixTimeColumns (AVX-512)"};
+static const char *unixBatchLevelNames[TINY_MAX_SIMD_LEVELS] = {
+    [TINY_SIMD_NONE] = "tiny_getUnixTimeBatch (scalar)",
+    [TINY_SIMD_SSE41] = "tiny_getUnixTimeBatch (SSE4.1)",
+    [TINY_SIMD_AVX2] = "tiny_getUnixTimeBatch (AVX2)",
+    [TINY_SIMD_AVX512] = "tiny_getUnixTimeBatch (AVX-512)"};
+static uint8_t secs[BENCH_ELEMENTS], mins[BENCH_ELEMENTS], hours[BENCH_ELEMENTS];
+static uint8_t monthDays[BENCH_ELEMENTS], months[BENCH_ELEMENTS];
+static uint16_t years[BENCH_ELEMENTS];
+static const char *simdLevelNames[TINY_MAX_SIMD_LEVELS] = {
+    [TINY_SIMD_NONE] = "tiny_getTimeTypeBatch (scalar)",
+    [TINY_SIMD_SSE41] = "tiny_getTimeTypeBatch (SSE4.1)",
+    [TINY_SIMD_AVX2] = "tiny_getTimeTypeBatch (AVX2)",
+    [TINY_SIMD_AVX512] = "tiny_getTimeTypeBatch (AVX-512)"};
+
+/**
+ * @brief Names of the batch formatter benchmarks per SIMD level
+ *
+ */
+static const char *formatLevelNames[TINY_MAX_SIMD_LEVELS] = {
+    [TINY_SIMD_NONE] = "tiny_formatBatch (scalar)",
+    [TINY_SIMD_SSE41] = "tiny_formatBatch (SSE4.1)",
+    [TINY_SIMD_AVX2] = "tiny_formatBatch (AVX2)",
+    [TINY_SIMD_AVX512] = "tiny_formatBatch (AVX-512)"};
+
+/**
+ * @brief Names of the RFC 3339 parser benchmarks per SIMD level
+ *
+ */
+static const char *parseRfc3339LevelNames[TINY_MAX_SIMD_LEVELS] = {
+    [TINY_SIMD_NONE] = "tiny_parseRfc3339 (scalar)",
+    [TINY_SIMD_SSE41] = "tiny_parseRfc3339 (SSE4.1)",
+    [TINY_SIMD_AVX2] = "tiny_parseRfc3339 (AVX2)",
+    [TINY_SIMD_AVX512] = "tiny_parseRfc3339 (AVX-512)"};
+
+/**
+ * @brief Returns a monotonic timestamp in nanoseconds
+ */
+static uint64_t bench_now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000U + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief Prints the result of a benchmark
+ *
+ * @param name The name of the benchmark
+ * @param elapsed The elapsed nanoseconds of all rounds
+ */
+static void bench_report(const char *name, const uint64_t elapsed) {
+  const double elements = (double)BENCH_ELEMENTS * BENCH_ROUNDS;
+  printf("%-32s %8.2f ns/element %8.3f elements/ns\n", name,
+         (double)elapsed / elements, elements / (double)elapsed);
+}
+
+/**
+ * @brief Warns about SIMD levels slower than the supported level below them
+ *
+ * @param names The benchmark names of the levels
+ * @param elapsed The elapsed nanoseconds of the levels, 0 if not supported
+ */
+static void bench_checkLevels(const char *names[], const uint64_t elapsed[]) {
+  uint8_t lower = TINY_MAX_SIMD_LEVELS;
+  for (uint8_t level = TINY_SIMD_NONE; level < TINY_MAX_SIMD_LEVELS; level++) {
+    if (0 == elapsed[level]) {
+      continue;
+    }
+    if (lower < TINY_MAX_SIMD_LEVELS && (double)elapsed[level] > BENCH_LEVEL_TOLERANCE * (double)elapsed[lower]) {
+      printf("warning: %s is slower than %s\n", names[level], names[lower]);
+    }
+    lower = level;
+  }
+}
+
+static void bench_getTimeType(void) {
+  uint64_t start = bench_now();
+  for (uint32_t round = 0; round < BENCH_ROUNDS; round++) {
+    for (uint32_t i = 0; i < BENCH_ELEMENTS; i++) {
+      tiny_getTimeType(&timeTypes[i], unixTimes[i]);
+    }
+  }
+  bench_report("tiny_getTimeType", bench_now() - start);
+
+  for (uint8_t level = TINY_SIMD_NONE; level < TINY_MAX_SIMD_LEVELS; level++) {
+    if (level != (uint8_t)tiny_setSimdLevel((TINY_SIMD_LEVELS)level)) {
+      continue;
+    }
+    start = bench_now();
+    for (uint32_t round = 0; round < BENCH_ROUNDS; round++) {
+      tiny_getTimeTypeBatch(timeTypes, unixTimes, BENCH_ELEMENTS);
+    }
+    bench_report(simdLevelNames[level], bench_now() - start);
+  }
+  tiny_setSimdLevel(TINY_MAX_SIMD_LEVELS);
+  benchSink += timeTypes[BENCH_ELEMENTS - 1].year;
+}
+
+static void bench_convertTimeType(void) {
+  // Sorted stream with about 20 unix times per minute
+  static tinyUnixType sortedTimes[BENCH_ELEMENTS];
+  for (uint32_t i = 0; i < BENCH_ELEMENTS; i++) {
+    sortedTimes[i] = 1742560496U + i * 3U;
+  }
+  uint64_t start = bench_now();
+  for (uint32_t round = 0; round < BENCH_ROUNDS; round++) {
+    for (uint32_t i = 0; i < BENCH_ELEMENTS; i++) {
+      tiny_getTimeType(&timeTypes[i], sortedTimes[i]);
+    }
+  }
+  bench_report("tiny_getTimeType (sorted)", bench_now() - start);
+
+  tinyConverterType converter;
+  tiny_initConverter(&converter);
+  start = bench_now();
+  for (uint32_t round = 0; round < BENCH_ROUNDS; round++) {
+    for (uint32_t i = 0; i < BENCH_ELEMENTS; i++) {
+      tiny_convertTimeType(&converter, &timeTypes[i], sortedTimes[i]);
+    }
+  }
+  bench_report("tiny_convertTimeType (sorted)", bench_now() - start);
+  benchSink += timeTypes[BENCH_ELEMENTS - 1].year;
+}
+
+static void bench_getUnixTime(void) {
+  uint64_t start = bench_now();
+  for (uint32_t round = 0; round < BENCH_ROUNDS; round++) {
+    for (uint32_t i = 0; i < BENCH_ELEMENTS; i++) {
+      unixResults[i] = tiny_getUnixTime(&timeTypes[i]);
+    }
+  }
+  bench_report("tiny_getUnixTime", bench_now() - start);
+
+  for (uint8_t level = TINY_SIMD_NONE; level < TINY_MAX_SIMD_LEVELS; level++) {
+    if (level != (uint8_t)tiny_setSimdLevel((TINY_SIMD_LEVELS)level)) {
+      continue;
+    }
+    start = bench_now();
+    for (uint32_t round = 0; round < BENCH_ROUNDS; round++) {
+      benchSink += tiny_getUnixTimeBatch(unixResults, timeTypes, BENCH_ELEMENTS,
+                                         invalidMap);
+    }
+    bench_report(unixBatchLevelNames[level], bench_now() - start);
+  }
+  tiny_setSimdLevel(TINY_MAX_SIMD_LEVELS);
+
+  const tinyTimeColumnsType columns = {.sec = secs,
+                                       .min = mins,
+                                       .hour = hours,
+                                       .monthDay = monthDays,
+                                       .month = months,
+                                       .year = years};
+  for (uint32_t i = 0; i < BENCH_ELEMENTS; i++) {
+    secs[i] = timeTypes[i].sec;
+    mins[i] = timeTypes[i].min;
+    hours[i] = timeTypes[i].hour;
+    monthDays[i] = timeTypes[i].monthDay;
+    months[i] = timeTypes[i].month;
+    years[i] = timeTypes[i].year;
+  }
+  for (uint8_t level = TINY_SIMD_NONE; level < TINY_MAX_SIMD_LEVELS; level++) {
+    if (level != (uint8_t)tiny_setSimdLevel((TINY_SIMD_LEVELS)level)) {
+      continue;
+    }
+    start = bench_now();
+    for (uint32_t round = 0; round < BENCH_ROUNDS; round++) {
+      benchSink += tiny_getUnixTimeColumns(unixResults, &columns,
+                                           BENCH_ELEMENTS, invalidMap);
+    }
+    bench_report(columnLevelNames[level], bench_now() - start);
+  }
+  tiny_setSimdLevel(TINY_MAX_SIMD_LEVELS);
+  benchSink += unixResults[BENCH_ELEMENTS - 1];
+}
+
+/**
+ * @brief The snprintf based format of the former tiny_getFormat
+ */
+static int bench_snprintfFormat(char *buf, size_t len, const tinyTimeType *tm) {
+  const char *weekDays[TINY_MAX_WEAKDAYS] = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
+  const char *months[TINY_MAX_MONTHS - TINY_JAN] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun",
+                                                    "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+  return snprintf(buf, len, "%s %2d %s %4d %.2d:%.2d:%.2d", weekDays[tm->weakDay], tm->monthDay,
+                  months[tm->month - TINY_JAN], tm->year, tm->hour, tm->min, tm->sec);
+}
+
+static void bench_format(void) {
+  char buffer[TINY_FORMAT_BUFFER_SIZE];
+  uint64_t start = bench_now();
+  for (uint32_t round = 0; round < BENCH_ROUNDS; round++) {
+    for (uint32_t i = 0; i < BENCH_ELEMENTS; i++) {
+      benchSink += (uint64_t)bench_snprintfFormat(buffer, sizeof(buffer), &timeTypes[i]);
+    }
+  }
+  bench_report("snprintf format", bench_now() - start);
+
+  start = bench_now();
+  for (uint32_t round = 0; round < BENCH_ROUNDS; round++) {
+    for (uint32_t i = 0; i < BENCH_ELEMENTS; i++) {
+      benchSink += tiny_formatTo(buffer, sizeof(buffer), &timeTypes[i]);
+    }
+  }
+  bench_report("tiny_formatTo", bench_now() - start);
+
+  // Callers holding only the unix time
+  start = bench_now();
+  for (uint32_t round = 0; round < BENCH_ROUNDS; round++) {
+    for (uint32_t i = 0; i < BENCH_ELEMENTS; i++) {
+      tinyTimeType timeType;
+      tiny_getTimeType(&timeType, unixTimes[i]);
+      benchSink += tiny_formatTo(buffer, sizeof(buffer), &timeType);
+    }
+  }
+  bench_report("tiny_getTimeType + tiny_formatTo", bench_now() - start);
+
+  start = bench_now();
+  for (uint32_t round = 0; round < BENCH_ROUNDS; round++) {
+    for (uint32_t i = 0; i < BENCH_ELEMENTS; i++) {
+      benchSink += tiny_formatUnix(buffer, sizeof(buffer), unixTimes[i]);
+    }
+  }
+  bench_report("tiny_formatUnix", bench_now() - start);
+
+  // Logging stream with about 20 formatted unix times per second
+  tinyFormatCacheType cache;
+  tiny_initFormatCache(&cache);
+  start = bench_now();
+  for (uint32_t round = 0; round < BENCH_ROUNDS; round++) {
+    for (uint32_t i = 0; i < BENCH_ELEMENTS; i++) {
+      benchSink += (uint8_t)tiny_getFormatCached(&cache, 1742560496U + i / 20U)[0];
+    }
+  }
+  bench_report("tiny_getFormatCached", bench_now() - start);
+
+  start = bench_now();
+  for (uint32_t round = 0; round < BENCH_ROUNDS; round++) {
+    for (uint32_t i = 0; i < BENCH_ELEMENTS; i++) {
+      tiny_getTimeType(&timeTypes[0], 1742560496U + i / 20U);
+      benchSink += tiny_formatTo(buffer, sizeof(buffer), &timeTypes[0]);
+    }
+  }
+  bench_report("tiny_getTimeType + tiny_formatTo", bench_now() - start);
+}
+
+static void bench_formatProgram(void) {
+  static struct tm cTimes[BENCH_ELEMENTS];
+  for (uint32_t i = 0; i < BENCH_ELEMENTS; i++) {
+    cTimes[i] = (struct tm){.tm_sec = timeTypes[i].sec,
+                            .tm_min = timeTypes[i].min,
+                            .tm_hour = timeTypes[i].hour,
+                            .tm_mday = timeTypes[i].monthDay,
+                            .tm_mon = timeTypes[i].month - 1,
+                            .tm_year = timeTypes[i].year - 1900,
+                            .tm_wday = timeTypes[i].weakDay,
+                            .tm_yday = timeTypes[i].yearDay - 1};
+  }
+  const char *pattern = "%Y-%m-%d %H:%M:%S";
+  char buffer[TINY_FORMAT_PROGRAM_LENGTH + 1];
+  uint64_t start = bench_now();
+  for (uint32_t round = 0; round < BENCH_ROUNDS; round++) {
+    for (uint32_t i = 0; i < BENCH_ELEMENTS; i++) {
+      benchSink += strftime(buffer, sizeof(buffer), pattern, &cTimes[i]);
+    }
+  }
+  bench_report("strftime", bench_now() - start);
+
+  tinyFormatProgramType prog;
+  tiny_formatCompile(&prog, pattern);
+  start = bench_now();
+  for (uint32_t round = 0; round < BENCH_ROUNDS; round++) {
+    for (uint32_t i = 0; i < BENCH_ELEMENTS; i++) {
+      benchSink += tiny_formatRun(&prog, &timeTypes[i], buffer, sizeof(buffer));
+    }
+  }
+  bench_report("tiny_formatRun", bench_now() - start);
+}
+
+static void bench_formatRfc3339(void) {
+  // Milliseconds and a +02:00 offset
+  char buffer[TINY_RFC3339_BUFFER_SIZE + 16];
+  uint64_t start = bench_now();
+  for (uint32_t round = 0; round < BENCH_ROUNDS; round++) {
+    for (uint32_t i = 0; i < BENCH_ELEMENTS; i++) {
+      struct tm cTime;
+      const time_t localTime = (time_t)unixTimes[i] + 7200;
+      gmtime_r(&localTime, &cTime);
+      size_t length = strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%S", &cTime);
+      length += (size_t)snprintf(&buffer[length], sizeof(buffer) - length, ".%03u+%02d:%02d", i % 1000U, 2, 0);
+      benchSink += length;
+    }
+  }
+  bench_report("gmtime_r + strftime + snprintf", bench_now() - start);
+
+  start = bench_now();
+  for (uint32_t round = 0; round < BENCH_ROUNDS; round++) {
+    for (uint32_t i = 0; i < BENCH_ELEMENTS; i++) {
+      benchSink += tiny_formatRfc3339(buffer, sizeof(buffer), unixTimes[i], i % 1000U * 1000000U, 3, 120);
+    }
+  }
+  bench_report("tiny_formatRfc3339", bench_now() - start);
+}
+
+static void bench_parseRfc3339(void) {
+  // JSON log timestamps with microseconds
+#define RFC3339_STRIDE (32U)
+  static char strings[BENCH_ELEMENTS * RFC3339_STRIDE];
+  for (uint32_t i = 0; i < BENCH_ELEMENTS; i++) {
+    tiny_formatRfc3339(&strings[i * RFC3339_STRIDE], RFC3339_STRIDE, unixTimes[i], i * 1000U, 6, 0);
+  }
+  uint64_t start = bench_now();
+  for (uint32_t round = 0; round < BENCH_ROUNDS; round++) {
+    for (uint32_t i = 0; i < BENCH_ELEMENTS; i++) {
+      tinyTimeType timeType = {0};
+      int year, month, monthDay, hour, min, sec;
+      unsigned int microSec;
+      benchSink += (uint64_t)sscanf(&strings[i * RFC3339_STRIDE], "%4d-%2d-%2dT%2d:%2d:%2d.%6uZ", &year, &month,
+                                    &monthDay, &hour, &min, &sec, &microSec);
+      timeType.year = (uint16_t)year;
+      timeType.month = (uint8_t)month;
+      timeType.monthDay = (uint8_t)monthDay;
+      timeType.hour = (uint8_t)hour;
+      timeType.min = (uint8_t)min;
+      timeType.sec = (uint8_t)sec;
+      benchSink += tiny_getUnixTime(&timeType) + microSec;
+    }
+  }
+  bench_report("sscanf + tiny_getUnixTime", bench_now() - start);
+
+  // Interleave the levels and keep the best pass, so noise does not change the order
+  tinyUnixType unixTime;
+  uint32_t nanoSec;
+  uint64_t elapsed[TINY_MAX_SIMD_LEVELS] = {0};
+  for (uint32_t pass = 0; pass < BENCH_LEVEL_PASSES; pass++) {
+    for (uint8_t level = TINY_SIMD_NONE; level < TINY_MAX_SIMD_LEVELS; level++) {
+      if (level != (uint8_t)tiny_setSimdLevel((TINY_SIMD_LEVELS)level)) {
+        continue;
+      }
+      start = bench_now();
+      for (uint32_t round = 0; round < BENCH_ROUNDS / BENCH_LEVEL_PASSES; round++) {
+        for (uint32_t i = 0; i < BENCH_ELEMENTS; i++) {
+          benchSink += tiny_parseRfc3339(&strings[i * RFC3339_STRIDE], RFC3339_STRIDE, &unixTime, &nanoSec, NULL);
+          benchSink += unixTime + nanoSec;
+        }
+      }
+      const uint64_t passElapsed = (bench_now() - start) * BENCH_LEVEL_PASSES;
+      if (0 == elapsed[level] || passElapsed < elapsed[level]) {
+        elapsed[level] = passElapsed;
+      }
+    }
+  }
+  tiny_setSimdLevel(TINY_MAX_SIMD_LEVELS);
+  for (uint8_t level = TINY_SIMD_NONE; level < TINY_MAX_SIMD_LEVELS; level++) {
+    if (0 != elapsed[level]) {
+      bench_report(parseRfc3339LevelNames[level], elapsed[level]);
+    }
+  }
+  bench_checkLevels(parseRfc3339LevelNames, elapsed);
+}
+
+static void bench_httpDate(void) {
+  // Server with about 20 responses per second
+  char buffer[TINY_HTTP_DATE_BUFFER_SIZE];
+  uint64_t start = bench_now();
+  for (uint32_t round = 0; round < BENCH_ROUNDS; round++) {
+    for (uint32_t i = 0; i < BENCH_ELEMENTS; i++) {
+      benchSink += tiny_formatHttpDate(buffer, sizeof(buffer), 1742560496U + i / 20U);
+    }
+  }
+  bench_report("tiny_formatHttpDate", bench_now() - start);
+
+  tinyHttpDateType date;
+  tiny_initHttpDate(&date);
+  start = bench_now();
+  for (uint32_t round = 0; round < BENCH_ROUNDS; round++) {
+    for (uint32_t i = 0; i < BENCH_ELEMENTS; i++) {
+      benchSink += tiny_getHttpDate(&date, 1742560496U + i / 20U, buffer, sizeof(buffer));
+    }
+  }
+  bench_report("tiny_getHttpDate", bench_now() - start);
+}
+
+static void bench_formatBatch(void) {
+  // CSV like export of a unix time column
+  static char rows[BENCH_ELEMENTS * TINY_FORMAT_BUFFER_SIZE];
+  static int32_t offsets[BENCH_ELEMENTS + 1];
+  uint64_t start = bench_now();
+  for (uint32_t round = 0; round < BENCH_ROUNDS; round++) {
+    for (uint32_t i = 0; i < BENCH_ELEMENTS; i++) {
+      tiny_getTimeType(&timeTypes[i], unixTimes[i]);
+      memcpy(&rows[i * TINY_FORMAT_LENGTH], tiny_getFormat(&timeTypes[i]), TINY_FORMAT_LENGTH);
+    }
+  }
+  bench_report("tiny_getTimeType + tiny_getFormat", bench_now() - start);
+
+  for (uint8_t level = TINY_SIMD_NONE; level < TINY_MAX_SIMD_LEVELS; level++) {
+    if (level != (uint8_t)tiny_setSimdLevel((TINY_SIMD_LEVELS)level)) {
+      continue;
+    }
+    start = bench_now();
+    for (uint32_t round = 0; round < BENCH_ROUNDS; round++) {
+      benchSink += tiny_formatBatch(rows, TINY_FORMAT_LENGTH, unixTimes, BENCH_ELEMENTS, invalidMap);
+    }
+    bench_report(formatLevelNames[level], bench_now() - start);
+  }
+  tiny_setSimdLevel(TINY_MAX_SIMD_LEVELS);
+
+  start = bench_now();
+  for (uint32_t round = 0; round < BENCH_ROUNDS; round++) {
+    benchSink += tiny_formatBatchOffsets(rows, sizeof(rows), offsets, unixTimes, BENCH_ELEMENTS);
+  }
+  bench_report("tiny_formatBatchOffsets", bench_now() - start);
+  benchSink += (uint8_t)rows[BENCH_ELEMENTS - 1];
+}
+
+static void bench_parseFormat(void) {
+  // Read back the rows of a log export
+  static char rows[BENCH_ELEMENTS * TINY_FORMAT_LENGTH];
+  tiny_formatBatch(rows, TINY_FORMAT_LENGTH, unixTimes, BENCH_ELEMENTS, NULL);
+  tinyTimeType timeType;
+  uint64_t start = bench_now();
+  for (uint32_t round = 0; round < BENCH_ROUNDS; round++) {
+    for (uint32_t i = 0; i < BENCH_ELEMENTS; i++) {
+      benchSink += tiny_parseFormat(&rows[i * TINY_FORMAT_LENGTH], TINY_FORMAT_LENGTH, &timeType);
+    }
+  }
+  bench_report("tiny_parseFormat", bench_now() - start);
+
+  start = bench_now();
+  for (uint32_t round = 0; round < BENCH_ROUNDS; round++) {
+    for (uint32_t i = 0; i < BENCH_ELEMENTS; i++) {
+      tiny_parseFormat(&rows[i * TINY_FORMAT_LENGTH], TINY_FORMAT_LENGTH, &timeType);
+      benchSink += tiny_getUnixTime(&timeType);
+    }
+  }
+  bench_report("tiny_parseFormat + tiny_getUnixTime", bench_now() - start);
+}
+
+static void bench_parseCached(void) {
+  // Sorted log lines, a few seconds apart, mostly share the date
+#define SORTED_STRIDE (32U)
+  static char rfc3339Lines[BENCH_ELEMENTS * SORTED_STRIDE];
+  static char formatLines[BENCH_ELEMENTS * SORTED_STRIDE];
+  for (uint32_t i = 0; i < BENCH_ELEMENTS; i++) {
+    const tinyUnixType unixTime = 1735689600U + i * 3U;
+    tiny_formatRfc3339(&rfc3339Lines[i * SORTED_STRIDE], SORTED_STRIDE, unixTime, i * 1000U, 6, 0);
+    tiny_formatUnix(&formatLines[i * SORTED_STRIDE], SORTED_STRIDE, unixTime);
+  }
+  tinyUnixType unixTime;
+  uint32_t nanoSec;
+  uint64_t start = bench_now();
+  for (uint32_t round = 0; round < BENCH_ROUNDS; round++) {
+    for (uint32_t i = 0; i < BENCH_ELEMENTS; i++) {
+      benchSink += tiny_parseRfc3339(&rfc3339Lines[i * SORTED_STRIDE], SORTED_STRIDE, &unixTime, &nanoSec, NULL);
+      benchSink += unixTime + nanoSec;
+    }
+  }
+  bench_report("tiny_parseRfc3339 (sorted)", bench_now() - start);
+
+  tinyParseCacheType cache;
+  tiny_initParseCache(&cache);
+  start = bench_now();
+  for (uint32_t round = 0; round < BENCH_ROUNDS; round++) {
+    for (uint32_t i = 0; i < BENCH_ELEMENTS; i++) {
+      benchSink +=
+          tiny_parseRfc3339Cached(&cache, &rfc3339Lines[i * SORTED_STRIDE], SORTED_STRIDE, &unixTime, &nanoSec, NULL);
+      benchSink += unixTime + nanoSec;
+    }
+  }
+  bench_report("tiny_parseRfc3339Cached", bench_now() - start);
+
+  tinyTimeType timeType;
+  start = bench_now();
+  for (uint32_t round = 0; round < BENCH_ROUNDS; round++) {
+    for (uint32_t i = 0; i < BENCH_ELEMENTS; i++) {
+      tiny_parseFormat(&formatLines[i * SORTED_STRIDE], TINY_FORMAT_LENGTH, &timeType);
+      benchSink += tiny_getUnixTime(&timeType);
+    }
+  }
+  bench_report("tiny_parseFormat (sorted)", bench_now() - start);
+
+  tiny_initParseCache(&cache);
+  start = bench_now();
+  for (uint32_t round = 0; round < BENCH_ROUNDS; round++) {
+    for (uint32_t i = 0; i < BENCH_ELEMENTS; i++) {
+      benchSink += tiny_parseFormatCached(&cache, &formatLines[i * SORTED_STRIDE], TINY_FORMAT_LENGTH, &unixTime);
+      benchSink += unixTime;
+    }
+  }
+  bench_report("tiny_parseFormatCached", bench_now() - start);
+}
+
+static void bench_parseStream(void) {
+  // Sorted JSON log lines received in TCP segments
+#define STREAM_LINE_LENGTH (64U)
+#define STREAM_SEGMENT (1460U)
+  static char stream[BENCH_ELEMENTS * STREAM_LINE_LENGTH];
+  for (uint32_t i = 0; i < BENCH_ELEMENTS; i++) {
+    char *line = &stream[i * STREAM_LINE_LENGTH];
+    const size_t length =
+        tiny_formatRfc3339(line, STREAM_LINE_LENGTH, 1735689600U + i * 3U, i * 1000U, 6, 0);
+    memset(&line[length], ' ', STREAM_LINE_LENGTH - length - 1);
+    line[STREAM_LINE_LENGTH - 1] = '\n';
+  }
+  tinyStreamParserType parser;
+  size_t used;
+  uint64_t start = bench_now();
+  for (uint32_t round = 0; round < BENCH_ROUNDS; round++) {
+    tiny_initStreamParser(&parser);
+    size_t parsed = 0;
+    for (size_t pos = 0; pos < sizeof(stream); pos += STREAM_SEGMENT) {
+      const size_t segment = sizeof(stream) - pos < STREAM_SEGMENT ? sizeof(stream) - pos : STREAM_SEGMENT;
+      parsed += tiny_parseStream(&parser, &unixResults[parsed], BENCH_ELEMENTS - parsed, &stream[pos], segment, &used);
+    }
+    benchSink += parsed + unixResults[parsed - 1];
+  }
+  bench_report("tiny_parseStream (segments)", bench_now() - start);
+}
+
+static void bench_parseSyslog(void) {
+  // One sorted chunk of collector lines over the new year
+#define SYSLOG_LINE_LENGTH (32U)
+  static char lines[BENCH_ELEMENTS * SYSLOG_LINE_LENGTH];
+  static int32_t offsets[BENCH_ELEMENTS + 1];
+  const tinyUnixType refTime = 1735689600U; // 1.1.2025
+  for (uint32_t i = 0; i < BENCH_ELEMENTS; i++) {
+    char format[TINY_FORMAT_BUFFER_SIZE];
+    char *line = &lines[i * SYSLOG_LINE_LENGTH];
+    tiny_formatUnix(format, sizeof(format), refTime - BENCH_ELEMENTS + i);
+    memcpy(line, &format[7], 4);
+    memcpy(&line[4], &format[4], 3);
+    memcpy(&line[7], &format[16], 8);
+    memcpy(&line[TINY_SYSLOG_LENGTH], " host app[42]: message\n  ", SYSLOG_LINE_LENGTH - TINY_SYSLOG_LENGTH);
+    offsets[i] = (int32_t)(i * SYSLOG_LINE_LENGTH);
+  }
+  offsets[BENCH_ELEMENTS] = (int32_t)(BENCH_ELEMENTS * SYSLOG_LINE_LENGTH);
+
+  tinyTimeType timeType;
+  uint64_t start = bench_now();
+  for (uint32_t round = 0; round < BENCH_ROUNDS; round++) {
+    for (uint32_t i = 0; i < BENCH_ELEMENTS; i++) {
+      tiny_parseSyslog(&lines[i * SYSLOG_LINE_LENGTH], SYSLOG_LINE_LENGTH, refTime, &timeType);
+      benchSink += tiny_getUnixTime(&timeType);
+    }
+  }
+  bench_report("tiny_parseSyslog + tiny_getUnixTime", bench_now() - start);
+
+  start = bench_now();
+  for (uint32_t round = 0; round < BENCH_ROUNDS; round++) {
+    benchSink += tiny_parseSyslogBatch(unixResults, lines, offsets, BENCH_ELEMENTS, refTime, invalidMap);
+    benchSink += unixResults[round];
+  }
+  bench_report("tiny_parseSyslogBatch", bench_now() - start);
+}
+
+static void bench_parseEpoch(void) {
+  // Producer timestamps in seconds, milliseconds, microseconds and nanoseconds
+#define EPOCH_STRIDE (24U)
+  static char epochs[BENCH_ELEMENTS * EPOCH_STRIDE];
+  static const char *epochFormats[] = {"%llu", "%llu123", "%llu123456", "%llu123456789"};
+  for (uint32_t i = 0; i < BENCH_ELEMENTS; i++) {
+    snprintf(&epochs[i * EPOCH_STRIDE], EPOCH_STRIDE, epochFormats[i % 4U], (unsigned long long)unixTimes[i]);
+  }
+  uint64_t start = bench_now();
+  for (uint32_t round = 0; round < BENCH_ROUNDS; round++) {
+    for (uint32_t i = 0; i < BENCH_ELEMENTS; i++) {
+      char *end;
+      const char *epoch = &epochs[i * EPOCH_STRIDE];
+      const unsigned long long value = strtoull(epoch, &end, 10);
+      const long digits = end - epoch;
+      const unsigned long long scale = digits <= 11 ? 1U : digits <= 14 ? 1000U : digits <= 17 ? 1000000U : 1000000000U;
+      benchSink += value / scale + (value % scale) * (1000000000U / scale);
+    }
+  }
+  bench_report("strtoull + division", bench_now() - start);
+
+  start = bench_now();
+  for (uint32_t round = 0; round < BENCH_ROUNDS; round++) {
+    for (uint32_t i = 0; i < BENCH_ELEMENTS; i++) {
+      uint32_t nanoSec;
+      benchSink += tiny_parseEpoch(&epochs[i * EPOCH_STRIDE], EPOCH_STRIDE, TINY_EPOCH_AUTO, &nanoSec);
+      benchSink += nanoSec;
+    }
+  }
+  bench_report("tiny_parseEpoch", bench_now() - start);
+}
+
+static void bench_parseProgram(void) {
+  // Access log timestamps
+#define ACCESS_LOG_LENGTH (26U)
+#define ACCESS_LOG_STRIDE (ACCESS_LOG_LENGTH + 1U)
+  static char rows[BENCH_ELEMENTS * ACCESS_LOG_STRIDE];
+  tinyFormatProgramType formatProg;
+  tiny_formatCompile(&formatProg, "%d/%b/%Y:%H:%M:%S +0000");
+  for (uint32_t i = 0; i < BENCH_ELEMENTS; i++) {
+    tiny_formatRun(&formatProg, &timeTypes[i], &rows[i * ACCESS_LOG_STRIDE], ACCESS_LOG_STRIDE);
+  }
+  uint64_t start = bench_now();
+  for (uint32_t round = 0; round < BENCH_ROUNDS; round++) {
+    for (uint32_t i = 0; i < BENCH_ELEMENTS; i++) {
+      tinyTimeType timeType = {0};
+      char monthName[4];
+      int monthDay, year, hour, min, sec, offset;
+      benchSink += (uint64_t)sscanf(&rows[i * ACCESS_LOG_STRIDE], "%2d/%3s/%4d:%2d:%2d:%2d %5d", &monthDay, monthName,
+                                    &year, &hour, &min, &sec, &offset);
+      timeType.monthDay = (uint8_t)monthDay;
+      timeType.month = (uint8_t)(monthName[0] & 0x0F);
+      timeType.year = (uint16_t)year;
+      timeType.hour = (uint8_t)hour;
+      timeType.min = (uint8_t)min;
+      timeType.sec = (uint8_t)sec;
+      benchSink += tiny_getUnixTime(&timeType);
+    }
+  }
+  bench_report("sscanf + tiny_getUnixTime", bench_now() - start);
+
+  tinyParseProgramType prog;
+  tiny_parseCompile(&prog, "%d/%b/%Y:%H:%M:%S %z");
+  tinyTimeType timeType;
+  start = bench_now();
+  for (uint32_t round = 0; round < BENCH_ROUNDS; round++) {
+    for (uint32_t i = 0; i < BENCH_ELEMENTS; i++) {
+      benchSink += tiny_parseRun(&prog, &rows[i * ACCESS_LOG_STRIDE], ACCESS_LOG_LENGTH, &timeType);
+      benchSink += tiny_getUnixTime(&timeType);
+    }
+  }
+  bench_report("tiny_parseRun + tiny_getUnixTime", bench_now() - start);
+}
+
+int main(void) {
+  srand(1);
+  for (uint32_t i = 0; i < BENCH_ELEMENTS; i++) {
+    unixTimes[i] = ((tinyUnixType)rand() * (tinyUnixType)RAND_MAX + (tinyUnixType)rand()) % BENCH_MAX_UNIX;
+  }
+  tiny_getTimeTypeBatch(timeTypes, unixTimes, BENCH_ELEMENTS);
+
+  bench_getTimeType();
+  bench_convertTimeType();
+  tiny_getTimeTypeBatch(timeTypes, unixTimes, BENCH_ELEMENTS);
+  bench_getUnixTime();
+  bench_format();
+  tiny_getTimeTypeBatch(timeTypes, unixTimes, BENCH_ELEMENTS);
+  bench_formatProgram();
+  bench_formatRfc3339();
+  bench_parseRfc3339();
+  bench_httpDate();
+  bench_formatBatch();
+  bench_parseFormat();
+  bench_parseCached();
+  bench_parseStream();
+  bench_parseSyslog();
+  bench_parseEpoch();
+  bench_parseProgram();
+  return 0;
+}
@@ -25,7 +25,9 @@
 #include "unity.h"
 
 #include <stdbool.h>
+#include <stdio.h>
 #include <string.h>
+#include <time.h>
 
 /* timeType and Unix time base */
 struct
@@ -120,7 +122,31 @@ struct
          .yearDay = 346,
      },
         .unixTime = 4858067777,
-        .formatString = "Sun 12 Dec 2123 15:16:17"}};
+        .formatString = "Sun 12 Dec 2123 15:16:17"},
+    {.timeType = {
+         .sec = 59,
+         .min = 59,
+         .hour = 23,
+         .monthDay = 31,
+         .month = TINY_DEC,
+         .year = 1970,
+         .weakDay = TINY_THU,
+         .yearDay = 365,
+     },
+        .unixTime = 31535999,
+        .formatString = "Thu 31 Dec 1970 23:59:59"},
+    {.timeType = {
+         .sec = 8,
+         .min = 7,
+         .hour = 6,
+         .monthDay = 31,
+         .month = TINY_DEC,
+         .year = 2024,
+         .weakDay = TINY_TUE,
+         .yearDay = 366,
+     },
+        .unixTime = 1735625228,
+        .formatString = "Tue 31 Dec 2024 06:07:08"}};
 
 void setUp(void) {
 } // Empty needed definition
@@ -189,6 +215,17 @@ void test_getUnixTime(void) {
   invalidTimeType.year = TINY_UNIX_YEAR_BEGIN;
   invalidTimeType.month = TINY_MAX_MONTHS;
   TEST_ASSERT_EQUAL_UINT64(UINT64_MAX, tiny_getUnixTime(&invalidTimeType));
+  invalidTimeType.month = TINY_FEB;
+  invalidTimeType.monthDay = 29;
+  TEST_ASSERT_EQUAL_UINT64(UINT64_MAX, tiny_getUnixTime(&invalidTimeType));
+  invalidTimeType.monthDay = 0;
+  TEST_ASSERT_EQUAL_UINT64(UINT64_MAX, tiny_getUnixTime(&invalidTimeType));
+  invalidTimeType.monthDay = 1;
+  invalidTimeType.min = TINY_MINUTE_MAX + 1;
+  TEST_ASSERT_EQUAL_UINT64(UINT64_MAX, tiny_getUnixTime(&invalidTimeType));
+  invalidTimeType.min = TINY_MINUTE_MAX;
+  invalidTimeType.hour = TINY_HOUR_MAX + 1;
+  TEST_ASSERT_EQUAL_UINT64(UINT64_MAX, tiny_getUnixTime(&invalidTimeType));
 }
 
 void test_getTimeType(void) {
@@ -202,6 +239,286 @@ void test_getTimeType(void) {
   }
 }
 
+void test_getTimeTypeExhaustive(void) {
+  // Reference calendar walked day by day from 1.1.1970 to the last uint16 year
+  tinyTimeType expected = {
+      .monthDay = 1, .month = TINY_JAN, .year = TINY_UNIX_YEAR_BEGIN, .weakDay = TINY_THU, .yearDay = 1};
+  tinyTimeType actual = {0};
+  for (uint64_t day = 0;; day++) {
+    const uint32_t secInDay = (uint32_t)((day * 7919U) % TINY_ONE_DAY_IN_SEC);
+    tiny_getTimeType(&actual, day * TINY_ONE_DAY_IN_SEC + secInDay);
+    TEST_ASSERT_EQUAL_UINT16(expected.year, actual.year);
+    TEST_ASSERT_EQUAL_UINT8(expected.month, actual.month);
+    TEST_ASSERT_EQUAL_UINT8(expected.monthDay, actual.monthDay);
+    TEST_ASSERT_EQUAL_UINT16(expected.yearDay, actual.yearDay);
+    TEST_ASSERT_EQUAL_UINT8(expected.weakDay, actual.weakDay);
+    TEST_ASSERT_EQUAL_UINT8(secInDay / TINY_ONE_HOUR_IN_SEC, actual.hour);
+    TEST_ASSERT_EQUAL_UINT8((secInDay % TINY_ONE_HOUR_IN_SEC) / TINY_ONE_MIN_IN_SEC, actual.min);
+    TEST_ASSERT_EQUAL_UINT8(secInDay % TINY_ONE_MIN_IN_SEC, actual.sec);
+    // Convert back to unix time
+    TEST_ASSERT_EQUAL_UINT64(day * TINY_ONE_DAY_IN_SEC + secInDay, tiny_getUnixTime(&actual));
+    // Step the reference calendar one day forward
+    expected.weakDay = (uint8_t)((expected.weakDay + 1) % TINY_MAX_WEAKDAYS);
+    expected.yearDay++;
+    if (expected.monthDay++ < tiny_getMonthDays(expected.year, expected.month)) {
+      continue;
+    }
+    expected.monthDay = 1;
+    if (expected.month++ < TINY_DEC) {
+      continue;
+    }
+    if (UINT16_MAX == expected.year) {
+      break;
+    }
+    expected.month = TINY_JAN;
+    expected.yearDay = 1;
+    expected.year++;
+  }
+}
+
+/**
+ * @brief The former year and month loops of tiny_getTimeType.
+ *
+ * Returns day 0 of January of the next year for every 31st of December.
+ *
+ * @param tm The structure to fill
+ * @param unixTime The unix time to convert
+ */
+static void referenceGetTimeType(tinyTimeType *tm, const tinyUnixType unixTime) {
+  uint64_t days = unixTime / TINY_ONE_DAY_IN_SEC + 1;
+  uint64_t secInDay = unixTime % TINY_ONE_DAY_IN_SEC;
+  tm->hour = (uint8_t)(secInDay / TINY_ONE_HOUR_IN_SEC);
+  tm->min = (uint8_t)((secInDay % TINY_ONE_HOUR_IN_SEC) / TINY_ONE_MIN_IN_SEC);
+  tm->sec = (uint8_t)(secInDay % TINY_ONE_MIN_IN_SEC);
+  tm->weakDay = (uint8_t)((days + TINY_WED) % TINY_MAX_WEAKDAYS);
+  uint16_t year = TINY_UNIX_YEAR_BEGIN;
+  while (1) {
+    uint64_t daysInYear = TINY_ONE_YEAR_IN_DAYS + tiny_isLeapYear(year);
+    if (days < daysInYear) {
+      break;
+    }
+    days -= daysInYear;
+    year++;
+  }
+  tm->year = year;
+  tm->yearDay = (uint16_t)days;
+  for (uint8_t month = TINY_JAN; month < TINY_MAX_MONTHS; month++) {
+    uint16_t daysInMonth = tiny_getMonthDays(year, month);
+    if (days <= daysInMonth) {
+      tm->month = month;
+      tm->monthDay = (uint8_t)days;
+      return;
+    }
+    days -= daysInMonth;
+  }
+}
+
+void test_getTimeTypeReference(void) {
+  // Every day until 2400 and a sample of the days until the last uint16 year
+  const uint64_t lastDay = 23217003U; // 31.12.65535
+  tinyTimeType expected = {0};
+  tinyTimeType actual = {0};
+  for (uint64_t day = 0; day <= lastDay; day += day < 157054U ? 1U : 9973U) {
+    const tinyUnixType unixTime = day * TINY_ONE_DAY_IN_SEC + (day * 7919U) % TINY_ONE_DAY_IN_SEC;
+    referenceGetTimeType(&expected, unixTime);
+    tiny_getTimeType(&actual, unixTime);
+    if (0 == expected.yearDay) {
+      // Fixed: the 31st of December of the previous year
+      TEST_ASSERT_EQUAL_UINT8(TINY_JAN, expected.month);
+      TEST_ASSERT_EQUAL_UINT8(0, expected.monthDay);
+      expected.year--;
+      expected.month = TINY_DEC;
+      expected.monthDay = 31;
+      expected.yearDay = (uint16_t)(TINY_ONE_YEAR_IN_DAYS + tiny_isLeapYear(expected.year));
+    }
+    TEST_ASSERT_EQUAL_UINT16(expected.year, actual.year);
+    TEST_ASSERT_EQUAL_UINT8(expected.month, actual.month);
+    TEST_ASSERT_EQUAL_UINT8(expected.monthDay, actual.monthDay);
+    TEST_ASSERT_EQUAL_UINT16(expected.yearDay, actual.yearDay);
+    TEST_ASSERT_EQUAL_UINT8(expected.weakDay, actual.weakDay);
+    TEST_ASSERT_EQUAL_UINT8(expected.hour, actual.hour);
+    TEST_ASSERT_EQUAL_UINT8(expected.min, actual.min);
+    TEST_ASSERT_EQUAL_UINT8(expected.sec, actual.sec);
+  }
+}
+
+void test_getUnixTimeBatch(void) {
+#define BATCH_SIZE (sizeof(testTimes) / sizeof(testTimes[0]))
+  tinyTimeType timeTypes[BATCH_SIZE + 2];
+  tinyUnixType unixTimes[BATCH_SIZE + 2];
+  uint8_t invalidMap[2] = {0xFF, 0xFF};
+  for (size_t i = 0; i < BATCH_SIZE; i++) {
+    timeTypes[i] = testTimes[i].timeType;
+  }
+  // Add an invalid leap day and a valid one in the second map byte
+  timeTypes[BATCH_SIZE] = testTimes[2].timeType;
+  timeTypes[BATCH_SIZE].monthDay = 29;
+  timeTypes[BATCH_SIZE].month = TINY_FEB;
+  timeTypes[BATCH_SIZE + 1] = testTimes[1].timeType;
+  TEST_ASSERT_EQUAL_size_t(2, tiny_getUnixTimeBatch(unixTimes, timeTypes, BATCH_SIZE + 2, invalidMap));
+  for (size_t i = 0; i < BATCH_SIZE; i++) {
+    TEST_ASSERT_EQUAL_UINT64(testTimes[i].unixTime, unixTimes[i]);
+  }
+  TEST_ASSERT_EQUAL_UINT64(UINT64_MAX, unixTimes[BATCH_SIZE]);
+  TEST_ASSERT_EQUAL_UINT64(testTimes[1].unixTime, unixTimes[BATCH_SIZE + 1]);
+  TEST_ASSERT_EQUAL_HEX8(0x01, invalidMap[0]);
+  TEST_ASSERT_EQUAL_HEX8(1U << (BATCH_SIZE % 8), invalidMap[1]);
+  // Without an invalid map
+  TEST_ASSERT_EQUAL_size_t(1, tiny_getUnixTimeBatch(unixTimes, timeTypes, BATCH_SIZE, NULL));
+  // NULL arrays mark every element as invalid
+  invalidMap[0] = 0;
+  invalidMap[1] = 0;
+  TEST_ASSERT_EQUAL_size_t(3, tiny_getUnixTimeBatch(NULL, timeTypes, 3, invalidMap));
+  TEST_ASSERT_EQUAL_HEX8(0x07, invalidMap[0]);
+  TEST_ASSERT_EQUAL_size_t(9, tiny_getUnixTimeBatch(unixTimes, NULL, 9, invalidMap));
+  TEST_ASSERT_EQUAL_HEX8(0xFF, invalidMap[0]);
+  TEST_ASSERT_EQUAL_HEX8(0x01, invalidMap[1]);
+  TEST_ASSERT_EQUAL_size_t(3, tiny_getUnixTimeBatch(NULL, NULL, 3, NULL));
+}
+
+void test_getTimeTypeBatch(void) {
+  tinyUnixType unixTimes[BATCH_SIZE - 1];
+  tinyTimeType timeTypes[BATCH_SIZE - 1];
+  for (size_t i = 1; i < BATCH_SIZE; i++) {
+    unixTimes[i - 1] = testTimes[i].unixTime;
+  }
+  tiny_getTimeTypeBatch(timeTypes, unixTimes, BATCH_SIZE - 1);
+  for (size_t i = 1; i < BATCH_SIZE; i++) {
+    compareTimeTypes(&testTimes[i].timeType, &timeTypes[i - 1]);
+  }
+  // Check NULL arguments
+  tiny_getTimeTypeBatch(NULL, unixTimes, BATCH_SIZE - 1);
+  tiny_getTimeTypeBatch(timeTypes, NULL, BATCH_SIZE - 1);
+}
+
+void test_getTimeTypeBatchSimd(void) {
+#define SIMD_CHUNK (4099U)
+#define SIMD_TEST_DAYS (3300000U) // Beyond the SIMD limit of 2^38 seconds
+  static tinyUnixType unixTimes[SIMD_CHUNK];
+  static tinyTimeType timeTypes[SIMD_CHUNK];
+  tinyTimeType expected;
+  for (uint8_t level = TINY_SIMD_NONE; level < TINY_MAX_SIMD_LEVELS; level++) {
+    if (level != (uint8_t)tiny_setSimdLevel((TINY_SIMD_LEVELS)level)) {
+      continue; // Not supported by this CPU
+    }
+    // All days with changing day times, some blocks exceeding the limit
+    for (uint64_t firstDay = 0; firstDay < SIMD_TEST_DAYS; firstDay += SIMD_CHUNK) {
+      for (uint32_t i = 0; i < SIMD_CHUNK; i++) {
+        const uint64_t day = firstDay + i;
+        unixTimes[i] = day * TINY_ONE_DAY_IN_SEC + (day * 7919U) % TINY_ONE_DAY_IN_SEC;
+        if (0 == day % 10007U) {
+          unixTimes[i] = UINT64_MAX - day;
+        }
+      }
+      tiny_getTimeTypeBatch(timeTypes, unixTimes, SIMD_CHUNK);
+      for (uint32_t i = 0; i < SIMD_CHUNK; i++) {
+        tiny_getTimeType(&expected, unixTimes[i]);
+        TEST_ASSERT_EQUAL_UINT8(expected.sec, timeTypes[i].sec);
+        TEST_ASSERT_EQUAL_UINT8(expected.min, timeTypes[i].min);
+        TEST_ASSERT_EQUAL_UINT8(expected.hour, timeTypes[i].hour);
+        TEST_ASSERT_EQUAL_UINT8(expected.monthDay, timeTypes[i].monthDay);
+        TEST_ASSERT_EQUAL_UINT8(expected.month, timeTypes[i].month);
+        TEST_ASSERT_EQUAL_UINT16(expected.year, timeTypes[i].year);
+        TEST_ASSERT_EQUAL_UINT8(expected.weakDay, timeTypes[i].weakDay);
+        TEST_ASSERT_EQUAL_UINT16(expected.yearDay, timeTypes[i].yearDay);
+      }
+    }
+  }
+  // Restore the best level
+  tiny_setSimdLevel(TINY_MAX_SIMD_LEVELS);
+}
+
+void test_getUnixTimeColumns(void) {
+#define COLUMN_SIZE (14U * 33U + 3U) // All months and days of a year, odd tail
+  static uint8_t secs[COLUMN_SIZE], mins[COLUMN_SIZE], hours[COLUMN_SIZE];
+  static uint8_t monthDays[COLUMN_SIZE], months[COLUMN_SIZE];
+  static uint16_t years[COLUMN_SIZE];
+  static tinyUnixType unixTimes[COLUMN_SIZE];
+  static uint8_t invalidMap[(COLUMN_SIZE + 7) / 8];
+  static tinyTimeType timeTypes[COLUMN_SIZE];
+  static tinyUnixType batchTimes[COLUMN_SIZE];
+  static uint8_t batchMap[(COLUMN_SIZE + 7) / 8];
+  const tinyTimeColumnsType columns = {
+      .sec = secs, .min = mins, .hour = hours, .monthDay = monthDays, .month = months, .year = years};
+  const uint16_t edgeYears[] = {0, 1969, 2100, 2400, 9999, UINT16_MAX};
+  for (uint8_t level = TINY_SIMD_NONE; level < TINY_MAX_SIMD_LEVELS; level++) {
+    if (level != (uint8_t)tiny_setSimdLevel((TINY_SIMD_LEVELS)level)) {
+      continue; // Not supported by this CPU
+    }
+    for (uint16_t yearIndex = 0; yearIndex < 600 + sizeof(edgeYears) / sizeof(edgeYears[0]); yearIndex++) {
+      const uint16_t year = yearIndex < 600 ? (uint16_t)(1960 + yearIndex) : edgeYears[yearIndex - 600];
+      for (uint16_t i = 0; i < COLUMN_SIZE; i++) {
+        years[i] = year;
+        months[i] = (uint8_t)((i / 33U) % 14U);
+        monthDays[i] = (uint8_t)(i % 33U);
+        hours[i] = (uint8_t)((i * 7U + year) % 25U);
+        mins[i] = (uint8_t)((i * 11U + year) % 61U);
+        secs[i] = (uint8_t)((i * 13U + year) % 61U);
+      }
+      size_t expectedInvalid = 0;
+      memset(invalidMap, 0xA5, sizeof(invalidMap));
+      const size_t invalidCount = tiny_getUnixTimeColumns(unixTimes, &columns, COLUMN_SIZE, invalidMap);
+      // The same fields as time types for tiny_getUnixTimeBatch
+      for (uint16_t i = 0; i < COLUMN_SIZE; i++) {
+        const tinyTimeType timeType = {
+            .sec = secs[i], .min = mins[i], .hour = hours[i], .monthDay = monthDays[i], .month = months[i], .year = years[i]};
+        timeTypes[i] = timeType;
+      }
+      memset(batchMap, 0xA5, sizeof(batchMap));
+      const size_t batchInvalidCount = tiny_getUnixTimeBatch(batchTimes, timeTypes, COLUMN_SIZE, batchMap);
+      for (uint16_t i = 0; i < COLUMN_SIZE; i++) {
+        const tinyUnixType expected = tiny_getUnixTime(&timeTypes[i]);
+        expectedInvalid += (UINT64_MAX == expected);
+        TEST_ASSERT_EQUAL_UINT64(expected, unixTimes[i]);
+        TEST_ASSERT_EQUAL_UINT8(UINT64_MAX == expected, (invalidMap[i / 8] >> (i % 8)) & 1);
+        TEST_ASSERT_EQUAL_UINT64(expected, batchTimes[i]);
+        TEST_ASSERT_EQUAL_UINT8(UINT64_MAX == expected, (batchMap[i / 8] >> (i % 8)) & 1);
+      }
+      TEST_ASSERT_EQUAL_size_t(expectedInvalid, invalidCount);
+      TEST_ASSERT_EQUAL_size_t(expectedInvalid, batchInvalidCount);
+    }
+  }
+  tiny_setSimdLevel(TINY_MAX_SIMD_LEVELS);
+  // Check NULL arguments
+  tinyTimeColumnsType missingColumn = columns;
+  missingColumn.sec = NULL;
+  TEST_ASSERT_EQUAL_size_t(5, tiny_getUnixTimeColumns(unixTimes, &missingColumn, 5, NULL));
+  TEST_ASSERT_EQUAL_size_t(5, tiny_getUnixTimeColumns(unixTimes, NULL, 5, NULL));
+  TEST_ASSERT_EQUAL_size_t(5, tiny_getUnixTimeColumns(NULL, &columns, 5, NULL));
+}
+
+void test_convertTimeType(void) {
+  tinyConverterType converter;
+  tinyTimeType expected;
+  tinyTimeType actual;
+  tiny_initConverter(&converter);
+  // Sorted stream with steps within the day, to the next day and further
+  const uint64_t steps[] = {1, 59, 3600, 7, TINY_ONE_DAY_IN_SEC, 86399, 86401, 40000, 5 * TINY_ONE_DAY_IN_SEC, 13};
+  tinyUnixType unixTime = 0;
+  for (uint32_t i = 0; unixTime < 4102444800U; i++) { // Until 1.1.2100
+    tiny_convertTimeType(&converter, &actual, unixTime);
+    tiny_getTimeType(&expected, unixTime);
+    compareTimeTypes(&expected, &actual);
+    TEST_ASSERT_EQUAL_UINT16(expected.year, actual.year);
+    TEST_ASSERT_EQUAL_UINT16(expected.yearDay, actual.yearDay);
+    unixTime += steps[i % (sizeof(steps) / sizeof(steps[0]))];
+  }
+  // Jumps backwards and to the end of the year range
+  const tinyUnixType jumps[] = {1742560496, 1742560495, 946684799, 946684800, 2066860799, 2066860800, 2066947199,
+                                2066947200, 4858067777, 0, UINT64_MAX, UINT64_MAX - 1, 2005949145599, 2005949145600};
+  for (size_t i = 0; i < sizeof(jumps) / sizeof(jumps[0]); i++) {
+    tiny_convertTimeType(&converter, &actual, jumps[i]);
+    tiny_getTimeType(&expected, jumps[i]);
+    compareTimeTypes(&expected, &actual);
+    TEST_ASSERT_EQUAL_UINT16(expected.year, actual.year);
+    TEST_ASSERT_EQUAL_UINT16(expected.yearDay, actual.yearDay);
+  }
+  // Check NULL arguments
+  tiny_initConverter(NULL);
+  tiny_convertTimeType(NULL, &actual, 0);
+  tiny_convertTimeType(&converter, NULL, 0);
+}
+
 void test_getFormat(void) {
   // Check NULL argument
   TEST_ASSERT_EQUAL_PTR(NULL, tiny_getFormat(NULL));
@@ -218,6 +535,907 @@ void test_getFormat(void) {
   TEST_ASSERT_EQUAL_STRING("Month  13 not in range", tiny_getFormat(&wrongValues));
 }
 
+void test_formatTo(void) {
+  char buffer[TINY_FORMAT_BUFFER_SIZE];
+  char secondBuffer[TINY_FORMAT_BUFFER_SIZE];
+  // Check valid days
+  for (size_t i = 1; i < sizeof(testTimes) / sizeof(testTimes[0]); i++) {
+    TEST_ASSERT_EQUAL_size_t(TINY_FORMAT_LENGTH, tiny_formatTo(buffer, sizeof(buffer), &testTimes[i].timeType));
+    TEST_ASSERT_EQUAL_STRING(testTimes[i].formatString, buffer);
+  }
+  // Two results at the same time
+  tiny_formatTo(buffer, sizeof(buffer), &testTimes[1].timeType);
+  tiny_formatTo(secondBuffer, sizeof(secondBuffer), &testTimes[2].timeType);
+  TEST_ASSERT_EQUAL_STRING(testTimes[1].formatString, buffer);
+  TEST_ASSERT_EQUAL_STRING(testTimes[2].formatString, secondBuffer);
+  // Exact and too small buffers
+  TEST_ASSERT_EQUAL_size_t(TINY_FORMAT_LENGTH, tiny_formatTo(buffer, TINY_FORMAT_LENGTH + 1, &testTimes[2].timeType));
+  TEST_ASSERT_EQUAL_size_t(0, tiny_formatTo(buffer, TINY_FORMAT_LENGTH, &testTimes[2].timeType));
+  TEST_ASSERT_EQUAL_STRING("", buffer);
+  // Wrong values
+  tinyTimeType wrongValues = {
+      .weakDay = TINY_MAX_WEAKDAYS,
+      .month = TINY_JAN};
+  TEST_ASSERT_EQUAL_size_t(20, tiny_formatTo(buffer, sizeof(buffer), &wrongValues));
+  TEST_ASSERT_EQUAL_STRING("Day   7 not in range", buffer);
+  // Check NULL arguments
+  TEST_ASSERT_EQUAL_size_t(0, tiny_formatTo(NULL, sizeof(buffer), &testTimes[1].timeType));
+  TEST_ASSERT_EQUAL_size_t(0, tiny_formatTo(buffer, sizeof(buffer), NULL));
+  TEST_ASSERT_EQUAL_size_t(0, tiny_formatTo(buffer, 0, &testTimes[1].timeType));
+}
+
+void test_formatToReference(void) {
+  // Compare with the printf format for regular and out of range fields
+  char buffer[TINY_FORMAT_BUFFER_SIZE];
+  char expected[TINY_FORMAT_BUFFER_SIZE + 8];
+  const uint8_t smallValues[] = {0, 1, 9, 10, 59, 99, 100, 255};
+  const uint16_t years[] = {0, 7, 99, 999, 1000, 1970, 9999, 10000, UINT16_MAX};
+  tinyTimeType timeType = {.weakDay = TINY_MON, .month = TINY_JAN};
+  for (size_t y = 0; y < sizeof(years) / sizeof(years[0]); y++) {
+    for (size_t i = 0; i < sizeof(smallValues) / sizeof(smallValues[0]); i++) {
+      for (size_t j = 0; j < sizeof(smallValues) / sizeof(smallValues[0]); j++) {
+        timeType.year = years[y];
+        timeType.monthDay = smallValues[i];
+        timeType.hour = smallValues[j];
+        timeType.min = smallValues[(i + j) % sizeof(smallValues)];
+        timeType.sec = smallValues[(i + 2 * j) % sizeof(smallValues)];
+        timeType.weakDay = (uint8_t)((i + y) % (TINY_MAX_WEAKDAYS + 1));
+        timeType.month = (uint8_t)((j + y) % (TINY_MAX_MONTHS + 1));
+        if (timeType.weakDay > TINY_SAT) {
+          snprintf(expected, sizeof(expected), "Day %3d not in range", timeType.weakDay);
+        } else if (timeType.month < TINY_JAN || timeType.month > TINY_DEC) {
+          snprintf(expected, sizeof(expected), "Month %3d not in range", timeType.month);
+        } else {
+          const char *weekDays[] = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
+          const char *months[] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+          snprintf(expected, sizeof(expected), "%s %2d %s %4d %.2d:%.2d:%.2d", weekDays[timeType.weakDay],
+                   timeType.monthDay, months[timeType.month - TINY_JAN], timeType.year, timeType.hour, timeType.min,
+                   timeType.sec);
+        }
+        TEST_ASSERT_EQUAL_size_t(strlen(expected), tiny_formatTo(buffer, sizeof(buffer), &timeType));
+        TEST_ASSERT_EQUAL_STRING(expected, buffer);
+        TEST_ASSERT_EQUAL_size_t(strlen(expected), tiny_formatLength(&timeType));
+        // Too small for the variable width string
+        TEST_ASSERT_EQUAL_size_t(0, tiny_formatTo(buffer, strlen(expected), &timeType));
+      }
+    }
+  }
+}
+
+void test_formatUnix(void) {
+  char buffer[TINY_FORMAT_BUFFER_SIZE];
+  char expected[TINY_FORMAT_BUFFER_SIZE];
+  tinyTimeType timeType;
+  // Same as the two call path, also for five digit years
+  for (size_t i = 1; i < sizeof(testTimes) / sizeof(testTimes[0]); i++) {
+    TEST_ASSERT_EQUAL_size_t(TINY_FORMAT_LENGTH, tiny_formatUnix(buffer, sizeof(buffer), testTimes[i].unixTime));
+    TEST_ASSERT_EQUAL_STRING(testTimes[i].formatString, buffer);
+  }
+  for (tinyUnixType unixTime = 0; unixTime < 400000000000U; unixTime += 3456789013U) {
+    tiny_getTimeType(&timeType, unixTime);
+    const size_t length = tiny_formatTo(expected, sizeof(expected), &timeType);
+    TEST_ASSERT_EQUAL_size_t(length, tiny_formatUnix(buffer, sizeof(buffer), unixTime));
+    TEST_ASSERT_EQUAL_STRING(expected, buffer);
+    TEST_ASSERT_EQUAL_size_t(length, tiny_formatUnixLength(unixTime));
+    // Exact and too small buffers
+    TEST_ASSERT_EQUAL_size_t(length, tiny_formatUnix(buffer, length + 1, unixTime));
+    TEST_ASSERT_EQUAL_size_t(0, tiny_formatUnix(buffer, length, unixTime));
+    TEST_ASSERT_EQUAL_STRING("", buffer);
+  }
+  // Last second of the year 9999 and the first one after it
+  TEST_ASSERT_EQUAL_size_t(TINY_FORMAT_LENGTH, tiny_formatUnix(buffer, sizeof(buffer), 253402300799U));
+  TEST_ASSERT_EQUAL_STRING("Fri 31 Dec 9999 23:59:59", buffer);
+  TEST_ASSERT_EQUAL_size_t(TINY_FORMAT_LENGTH + 1, tiny_formatUnix(buffer, sizeof(buffer), 253402300800U));
+  TEST_ASSERT_EQUAL_STRING("Sat  1 Jan 10000 00:00:00", buffer);
+  TEST_ASSERT_EQUAL_size_t(TINY_FORMAT_LENGTH, tiny_formatUnixLength(253402300799U));
+  TEST_ASSERT_EQUAL_size_t(TINY_FORMAT_LENGTH + 1, tiny_formatUnixLength(253402300800U));
+  // Check invalid arguments
+  TEST_ASSERT_EQUAL_size_t(0, tiny_formatUnix(NULL, sizeof(buffer), 0));
+  TEST_ASSERT_EQUAL_size_t(0, tiny_formatUnix(buffer, 0, 0));
+  TEST_ASSERT_EQUAL_size_t(0, tiny_formatLength(NULL));
+}
+
+void test_getFormatCached(void) {
+  tinyFormatCacheType cache;
+  tinyTimeType timeType;
+  tiny_initFormatCache(&cache);
+  TEST_ASSERT_EQUAL_STRING("Thu  1 Jan 1970 00:00:00", tiny_getFormatCached(&cache, 0));
+  // Same second, same day, next days, backwards and five digit years
+  const tinyUnixType unixTimes[] = {0, 1, 59, 60, 3599, 3600, 86399, 86400, 86401, 1742560496, 1742560496,
+                                    1742560497, 1742600000, 1742560000, 1742500000, 4858067777, 253402300799,
+                                    253402300800, 253402300801, 253402387199, 2005949145599, 0};
+  for (size_t i = 0; i < sizeof(unixTimes) / sizeof(unixTimes[0]); i++) {
+    tiny_getTimeType(&timeType, unixTimes[i]);
+    TEST_ASSERT_EQUAL_STRING(tiny_getFormat(&timeType), tiny_getFormatCached(&cache, unixTimes[i]));
+  }
+  // A sorted stream over several days
+  for (tinyUnixType unixTime = 1709150000; unixTime < 1709450000; unixTime += 37) {
+    tiny_getTimeType(&timeType, unixTime);
+    TEST_ASSERT_EQUAL_STRING(tiny_getFormat(&timeType), tiny_getFormatCached(&cache, unixTime));
+  }
+  // Check NULL arguments
+  tiny_initFormatCache(NULL);
+  TEST_ASSERT_EQUAL_PTR(NULL, tiny_getFormatCached(NULL, 0));
+}
+
+void test_formatCompile(void) {
+  tinyFormatProgramType prog;
+  char buffer[TINY_FORMAT_PROGRAM_LENGTH + 1];
+  const tinyTimeType timeType = {.sec = 5, .min = 4, .hour = 3, .monthDay = 2, .month = TINY_JAN, .year = 1970,
+                                 .weakDay = TINY_FRI, .yearDay = 2};
+  TEST_ASSERT_EQUAL_UINT8(1, tiny_formatCompile(&prog, "%Y-%m-%d %H:%M:%S"));
+  TEST_ASSERT_EQUAL_size_t(19, tiny_formatRun(&prog, &timeType, buffer, sizeof(buffer)));
+  TEST_ASSERT_EQUAL_STRING("1970-01-02 03:04:05", buffer);
+  TEST_ASSERT_EQUAL_size_t(19, tiny_formatRunLength(&prog, &timeType));
+  // Exact and too small buffers
+  TEST_ASSERT_EQUAL_size_t(19, tiny_formatRun(&prog, &timeType, buffer, 20));
+  TEST_ASSERT_EQUAL_STRING("1970-01-02 03:04:05", buffer);
+  TEST_ASSERT_EQUAL_size_t(0, tiny_formatRun(&prog, &timeType, buffer, 19));
+  TEST_ASSERT_EQUAL_STRING("", buffer);
+  // Literals, escapes and an empty pattern
+  TEST_ASSERT_EQUAL_UINT8(1, tiny_formatCompile(&prog, "log_%%%n%t%F.txt"));
+  TEST_ASSERT_EQUAL_size_t(21, tiny_formatRun(&prog, &timeType, buffer, sizeof(buffer)));
+  TEST_ASSERT_EQUAL_STRING("log_%\n\t1970-01-02.txt", buffer);
+  TEST_ASSERT_EQUAL_UINT8(1, tiny_formatCompile(&prog, ""));
+  TEST_ASSERT_EQUAL_size_t(0, tiny_formatRun(&prog, &timeType, buffer, sizeof(buffer)));
+  TEST_ASSERT_EQUAL_STRING("", buffer);
+  // Out of range fields
+  const tinyTimeType wrongType = {.sec = 100, .min = 255, .hour = 24, .monthDay = 0, .month = 13, .year = 65535,
+                                  .weakDay = 7, .yearDay = 400};
+  TEST_ASSERT_EQUAL_UINT8(1, tiny_formatCompile(&prog, "%a %A %b %B %C %d %e %H %I %j %m %M %p %S %Y"));
+  tiny_formatRun(&prog, &wrongType, buffer, sizeof(buffer));
+  TEST_ASSERT_EQUAL_STRING("? ? ? ? 655 00  0 24 12 400 13 255 PM 100 65535", buffer);
+  TEST_ASSERT_EQUAL_size_t(strlen(buffer), tiny_formatRunLength(&prog, &wrongType));
+  const tinyTimeType shortYear = {.monthDay = 1, .month = TINY_MAY, .year = 7, .yearDay = 121};
+  TEST_ASSERT_EQUAL_UINT8(1, tiny_formatCompile(&prog, "%Y %U %W %u %w"));
+  TEST_ASSERT_EQUAL_size_t(tiny_formatRun(&prog, &shortYear, buffer, sizeof(buffer)),
+                           tiny_formatRunLength(&prog, &shortYear));
+  TEST_ASSERT_EQUAL_STRING("7 18 17 7 0", buffer);
+  // Unsupported conversions and program limits
+  TEST_ASSERT_EQUAL_UINT8(0, tiny_formatCompile(&prog, "%Q"));
+  TEST_ASSERT_EQUAL_UINT8(0, tiny_formatCompile(&prog, "%Y%"));
+  TEST_ASSERT_EQUAL_size_t(0, tiny_formatRun(&prog, &timeType, buffer, sizeof(buffer)));
+  char pattern[2 * TINY_FORMAT_PROGRAM_OPS + 1] = {0};
+  memset(pattern, 'x', TINY_FORMAT_PROGRAM_LITERALS);
+  TEST_ASSERT_EQUAL_UINT8(1, tiny_formatCompile(&prog, pattern));
+  pattern[TINY_FORMAT_PROGRAM_LITERALS] = 'x';
+  TEST_ASSERT_EQUAL_UINT8(0, tiny_formatCompile(&prog, pattern));
+  memset(pattern, 0, sizeof(pattern));
+  for (size_t i = 0; i < TINY_FORMAT_PROGRAM_OPS; i++) {
+    memcpy(&pattern[2 * i], "%H", 2);
+  }
+  TEST_ASSERT_EQUAL_UINT8(1, tiny_formatCompile(&prog, pattern));
+  TEST_ASSERT_EQUAL_UINT8(0, tiny_formatCompile(&prog, "%c%c%c%c%c"));
+  // Check NULL arguments
+  TEST_ASSERT_EQUAL_UINT8(0, tiny_formatCompile(NULL, "%Y"));
+  TEST_ASSERT_EQUAL_UINT8(0, tiny_formatCompile(&prog, NULL));
+  TEST_ASSERT_EQUAL_size_t(0, tiny_formatRun(NULL, &timeType, buffer, sizeof(buffer)));
+  TEST_ASSERT_EQUAL_size_t(0, tiny_formatRun(&prog, NULL, buffer, sizeof(buffer)));
+  TEST_ASSERT_EQUAL_size_t(0, tiny_formatRun(&prog, &timeType, NULL, sizeof(buffer)));
+  TEST_ASSERT_EQUAL_size_t(0, tiny_formatRun(&prog, &timeType, buffer, 0));
+  TEST_ASSERT_EQUAL_size_t(0, tiny_formatRunLength(NULL, &timeType));
+  TEST_ASSERT_EQUAL_size_t(0, tiny_formatRunLength(&prog, NULL));
+}
+
+void test_formatRunReference(void) {
+  // Compare every conversion with strftime of the C library
+  const char *patterns[] = {"%a %A %b %B %h %C %d %e %H %I %j %m %M %p %S",
+                            "%u %U %w %W %y %Y %c %%", "%D %F %R", "%T %x %X"};
+  tinyFormatProgramType progs[sizeof(patterns) / sizeof(patterns[0])];
+  for (size_t p = 0; p < sizeof(patterns) / sizeof(patterns[0]); p++) {
+    TEST_ASSERT_EQUAL_UINT8(1, tiny_formatCompile(&progs[p], patterns[p]));
+  }
+  char buffer[TINY_FORMAT_PROGRAM_LENGTH + 1];
+  char expected[TINY_FORMAT_PROGRAM_LENGTH + 1];
+  tinyTimeType timeType;
+  // Every day until 2100 with changing day times
+  for (tinyUnixType unixTime = 0; unixTime < 4102444800U; unixTime += TINY_ONE_DAY_IN_SEC + 3607U) {
+    const time_t cTime = (time_t)unixTime;
+    const struct tm *cTm = gmtime(&cTime);
+    tiny_getTimeType(&timeType, unixTime);
+    for (size_t p = 0; p < sizeof(patterns) / sizeof(patterns[0]); p++) {
+      const size_t length = strftime(expected, sizeof(expected), patterns[p], cTm);
+      TEST_ASSERT_EQUAL_size_t(length, tiny_formatRun(&progs[p], &timeType, buffer, sizeof(buffer)));
+      TEST_ASSERT_EQUAL_STRING(expected, buffer);
+      TEST_ASSERT_EQUAL_size_t(length, tiny_formatRunLength(&progs[p], &timeType));
+    }
+  }
+}
+
+void test_formatRfc3339(void) {
+  char buffer[TINY_RFC3339_BUFFER_SIZE];
+  TEST_ASSERT_EQUAL_size_t(20, tiny_formatRfc3339(buffer, sizeof(buffer), 0, 0, 0, 0));
+  TEST_ASSERT_EQUAL_STRING("1970-01-01T00:00:00Z", buffer);
+  TEST_ASSERT_EQUAL_size_t(24, tiny_formatRfc3339(buffer, sizeof(buffer), 1742560496, 123456789, 3, 0));
+  TEST_ASSERT_EQUAL_STRING("2025-03-21T12:34:56.123Z", buffer);
+  TEST_ASSERT_EQUAL_size_t(32, tiny_formatRfc3339(buffer, sizeof(buffer), 1742560496, 1234, 6, 120));
+  TEST_ASSERT_EQUAL_STRING("2025-03-21T14:34:56.000001+02:00", buffer);
+  TEST_ASSERT_EQUAL_size_t(35, tiny_formatRfc3339(buffer, sizeof(buffer), 1742560496, 999999999, 9, -570));
+  TEST_ASSERT_EQUAL_STRING("2025-03-21T03:04:56.999999999-09:30", buffer);
+  TEST_ASSERT_EQUAL_size_t(25, tiny_formatRfc3339(buffer, sizeof(buffer), 0, 0, 0, TINY_RFC3339_MAX_OFFSET));
+  TEST_ASSERT_EQUAL_STRING("1970-01-01T23:59:00+23:59", buffer);
+  TEST_ASSERT_EQUAL_size_t(25, tiny_formatRfc3339(buffer, sizeof(buffer), 253402300799, 0, 0, -60));
+  TEST_ASSERT_EQUAL_STRING("9999-12-31T22:59:59-01:00", buffer);
+  // Exact and too small buffers
+  TEST_ASSERT_EQUAL_size_t(24, tiny_formatRfc3339(buffer, 25, 1742560496, 123456789, 3, 0));
+  TEST_ASSERT_EQUAL_STRING("2025-03-21T12:34:56.123Z", buffer);
+  TEST_ASSERT_EQUAL_size_t(0, tiny_formatRfc3339(buffer, 24, 1742560496, 123456789, 3, 0));
+  TEST_ASSERT_EQUAL_STRING("", buffer);
+  // Invalid arguments and local times
+  TEST_ASSERT_EQUAL_size_t(0, tiny_formatRfc3339(buffer, sizeof(buffer), 0, 1000000000, 3, 0));
+  TEST_ASSERT_EQUAL_size_t(0, tiny_formatRfc3339(buffer, sizeof(buffer), 0, 0, 10, 0));
+  TEST_ASSERT_EQUAL_size_t(0, tiny_formatRfc3339(buffer, sizeof(buffer), 0, 0, 0, TINY_RFC3339_MAX_OFFSET + 1));
+  TEST_ASSERT_EQUAL_size_t(0, tiny_formatRfc3339(buffer, sizeof(buffer), 0, 0, 0, INT16_MIN));
+  TEST_ASSERT_EQUAL_size_t(0, tiny_formatRfc3339(buffer, sizeof(buffer), 59, 0, 0, -1));
+  TEST_ASSERT_EQUAL_size_t(0, tiny_formatRfc3339(buffer, sizeof(buffer), 253402300800, 0, 0, 0));
+  TEST_ASSERT_EQUAL_size_t(0, tiny_formatRfc3339(buffer, sizeof(buffer), 253402300799, 0, 0, 1));
+  TEST_ASSERT_EQUAL_size_t(0, tiny_formatRfc3339(buffer, sizeof(buffer), UINT64_MAX, 0, 0, 1));
+  TEST_ASSERT_EQUAL_STRING("", buffer);
+  TEST_ASSERT_EQUAL_size_t(0, tiny_formatRfc3339Length(10, 0));
+  TEST_ASSERT_EQUAL_size_t(0, tiny_formatRfc3339Length(0, TINY_RFC3339_MAX_OFFSET + 1));
+  TEST_ASSERT_EQUAL_size_t(0, tiny_formatRfc3339Length(0, INT16_MIN));
+  // Check NULL arguments
+  TEST_ASSERT_EQUAL_size_t(0, tiny_formatRfc3339(NULL, sizeof(buffer), 0, 0, 0, 0));
+  TEST_ASSERT_EQUAL_size_t(0, tiny_formatRfc3339(buffer, 0, 0, 0, 0, 0));
+}
+
+void test_formatRfc3339Reference(void) {
+  // Compare with gmtime, strftime and snprintf
+  char buffer[TINY_RFC3339_BUFFER_SIZE];
+  char expected[TINY_RFC3339_BUFFER_SIZE + 16];
+  const int16_t offsets[] = {0, 1, -1, 60, -90, 345, -720, 840, TINY_RFC3339_MAX_OFFSET, -TINY_RFC3339_MAX_OFFSET};
+  uint32_t nanoSec = 7;
+  for (tinyUnixType unixTime = 86400; unixTime < 4102444800U; unixTime += 1234567U) {
+    for (size_t o = 0; o < sizeof(offsets) / sizeof(offsets[0]); o++) {
+      const uint8_t fractionDigits = (uint8_t)((unixTime + o) % (TINY_RFC3339_MAX_FRACTION + 1));
+      nanoSec = (nanoSec * 1103515245U + 12345U) % 1000000000U;
+      const time_t localTime = (time_t)unixTime + offsets[o] * 60;
+      size_t length = strftime(expected, sizeof(expected), "%Y-%m-%dT%H:%M:%S", gmtime(&localTime));
+      if (fractionDigits) {
+        char fraction[16];
+        snprintf(fraction, sizeof(fraction), "%09u", nanoSec);
+        length += (size_t)snprintf(&expected[length], sizeof(expected) - length, ".%.*s", fractionDigits, fraction);
+      }
+      if (offsets[o]) {
+        const int absOffset = offsets[o] < 0 ? -offsets[o] : offsets[o];
+        length += (size_t)snprintf(&expected[length], sizeof(expected) - length, "%c%02d:%02d",
+                                   offsets[o] < 0 ? '-' : '+', absOffset / 60, absOffset % 60);
+      } else {
+        length += (size_t)snprintf(&expected[length], sizeof(expected) - length, "Z");
+      }
+      TEST_ASSERT_EQUAL_size_t(length, tiny_formatRfc3339(buffer, sizeof(buffer), unixTime, nanoSec, fractionDigits,
+                                                          offsets[o]));
+      TEST_ASSERT_EQUAL_STRING(expected, buffer);
+      TEST_ASSERT_EQUAL_size_t(length, tiny_formatRfc3339Length(fractionDigits, offsets[o]));
+    }
+  }
+}
+
+void test_parseRfc3339(void) {
+  tinyUnixType unixTime = 0;
+  uint32_t nanoSec = 0;
+  int16_t offsetMin = 0;
+  const char *jsonValue = "2025-03-21T12:34:56.123456Z\",";
+  for (uint8_t level = TINY_SIMD_NONE; level < TINY_MAX_SIMD_LEVELS; level++) {
+    if (level != (uint8_t)tiny_setSimdLevel((TINY_SIMD_LEVELS)level)) {
+      continue; // Not supported by this CPU
+    }
+    TEST_ASSERT_EQUAL_size_t(27, tiny_parseRfc3339(jsonValue, strlen(jsonValue), &unixTime, &nanoSec, &offsetMin));
+    TEST_ASSERT_EQUAL_UINT64(1742560496U, unixTime);
+    TEST_ASSERT_EQUAL_UINT32(123456000U, nanoSec);
+    TEST_ASSERT_EQUAL_INT16(0, offsetMin);
+    TEST_ASSERT_EQUAL_size_t(25, tiny_parseRfc3339("2025-03-21t03:04:56-09:30", 25, &unixTime, &nanoSec, &offsetMin));
+    TEST_ASSERT_EQUAL_UINT64(1742560496U, unixTime);
+    TEST_ASSERT_EQUAL_UINT32(0, nanoSec);
+    TEST_ASSERT_EQUAL_INT16(-570, offsetMin);
+    // More than nine fraction digits are cut off
+    TEST_ASSERT_EQUAL_size_t(36, tiny_parseRfc3339("1970-01-01T01:00:00.9876543219+01:00", 36, &unixTime, &nanoSec,
+                                                   &offsetMin));
+    TEST_ASSERT_EQUAL_UINT64(0, unixTime);
+    TEST_ASSERT_EQUAL_UINT32(987654321U, nanoSec);
+    TEST_ASSERT_EQUAL_INT16(60, offsetMin);
+    TEST_ASSERT_EQUAL_size_t(20, tiny_parseRfc3339("9999-12-31T23:59:59z", 20, &unixTime, NULL, NULL));
+    TEST_ASSERT_EQUAL_UINT64(253402300799U, unixTime);
+    // Round trip with the formatter
+    char buffer[TINY_RFC3339_BUFFER_SIZE];
+    const int16_t offsets[] = {0, 1, -1, 345, -720, TINY_RFC3339_MAX_OFFSET, -TINY_RFC3339_MAX_OFFSET};
+    const uint32_t fractionScales[] = {1000000000U, 100000000U, 10000000U, 1000000U, 100000U,
+                                       10000U,      1000U,      100U,      10U,      1U};
+    for (tinyUnixType expected = 86400; expected < 253402300799U - 86400U; expected += 98765431U) {
+      for (size_t o = 0; o < sizeof(offsets) / sizeof(offsets[0]); o++) {
+        const uint8_t fractionDigits = (uint8_t)((expected + o) % (TINY_RFC3339_MAX_FRACTION + 1));
+        const uint32_t expectedNanoSec = (uint32_t)(expected % 1000000000U);
+        const size_t length =
+            tiny_formatRfc3339(buffer, sizeof(buffer), expected, expectedNanoSec, fractionDigits, offsets[o]);
+        TEST_ASSERT_EQUAL_size_t(length, tiny_parseRfc3339(buffer, length, &unixTime, &nanoSec, &offsetMin));
+        TEST_ASSERT_EQUAL_UINT64(expected, unixTime);
+        TEST_ASSERT_EQUAL_UINT32(expectedNanoSec - expectedNanoSec % fractionScales[fractionDigits], nanoSec);
+        TEST_ASSERT_EQUAL_INT16(offsets[o], offsetMin);
+      }
+    }
+    // Malformed strings and invalid dates
+    const char *wrongStrings[] = {
+        "2025-03-21T12:34:56",       "2025-03-21T12:34:56.Z",     "2025-03-21T12:34:56+01",
+        "2025-03-21T12:34:56+0100",  "2025-03-21T12:34:56+24:00", "2025-03-21T12:34:56+01:60",
+        "2025-03-21T12:34:56X",      "2025-03-21 12:34:56Z",      "2025/03/21T12:34:56Z",
+        "2025-03-21T12-34-56Z",      "2025-3-21T12:34:56Z",       "2025-03-21T12:34:5aZ",
+        "2025-13-21T12:34:56Z",      "2025-00-21T12:34:56Z",      "2025-02-29T12:34:56Z",
+        "2025-04-31T12:34:56Z",      "2025-03-21T24:00:00Z",      "2025-03-21T12:60:00Z",
+        "2025-03-21T12:34:60Z",      "1969-12-31T23:59:59Z",      "1970-01-01T00:59:59+01:00",
+        "2025-03-21T12:34:56.5",     "2025-03-21T12:34:56+01:0a", "a025-03-21T12:34:56Z"};
+    for (size_t i = 0; i < sizeof(wrongStrings) / sizeof(wrongStrings[0]); i++) {
+      TEST_ASSERT_EQUAL_size_t(0, tiny_parseRfc3339(wrongStrings[i], strlen(wrongStrings[i]), &unixTime, NULL, NULL));
+    }
+    // Check invalid arguments
+    TEST_ASSERT_EQUAL_size_t(0, tiny_parseRfc3339(jsonValue, 19, &unixTime, NULL, NULL));
+    TEST_ASSERT_EQUAL_size_t(0, tiny_parseRfc3339(NULL, 27, &unixTime, NULL, NULL));
+    TEST_ASSERT_EQUAL_size_t(0, tiny_parseRfc3339(jsonValue, 27, NULL, NULL, NULL));
+  }
+  // Restore the best level
+  tiny_setSimdLevel(TINY_MAX_SIMD_LEVELS);
+}
+
+void test_formatHttpDate(void) {
+  char buffer[TINY_HTTP_DATE_BUFFER_SIZE];
+  TEST_ASSERT_EQUAL_size_t(TINY_HTTP_DATE_LENGTH, tiny_formatHttpDate(buffer, sizeof(buffer), 784111777));
+  TEST_ASSERT_EQUAL_STRING("Sun, 06 Nov 1994 08:49:37 GMT", buffer);
+  TEST_ASSERT_EQUAL_size_t(TINY_HTTP_DATE_LENGTH, tiny_formatHttpDate(buffer, sizeof(buffer), 253402300799));
+  TEST_ASSERT_EQUAL_STRING("Fri, 31 Dec 9999 23:59:59 GMT", buffer);
+  // Compare with strftime
+  char expected[TINY_HTTP_DATE_BUFFER_SIZE];
+  for (tinyUnixType unixTime = 0; unixTime < 4102444800U; unixTime += 1234567U) {
+    const time_t cTime = (time_t)unixTime;
+    strftime(expected, sizeof(expected), "%a, %d %b %Y %H:%M:%S GMT", gmtime(&cTime));
+    TEST_ASSERT_EQUAL_size_t(TINY_HTTP_DATE_LENGTH, tiny_formatHttpDate(buffer, sizeof(buffer), unixTime));
+    TEST_ASSERT_EQUAL_STRING(expected, buffer);
+  }
+  // Too small buffers and too big times
+  TEST_ASSERT_EQUAL_size_t(0, tiny_formatHttpDate(buffer, TINY_HTTP_DATE_LENGTH, 0));
+  TEST_ASSERT_EQUAL_STRING("", buffer);
+  TEST_ASSERT_EQUAL_size_t(0, tiny_formatHttpDate(buffer, sizeof(buffer), 253402300800));
+  TEST_ASSERT_EQUAL_size_t(0, tiny_formatHttpDate(NULL, sizeof(buffer), 0));
+  TEST_ASSERT_EQUAL_size_t(0, tiny_formatHttpDate(buffer, 0, 0));
+
+  // Shared date of the current second
+  tinyHttpDateType date;
+  tiny_initHttpDate(&date);
+  TEST_ASSERT_EQUAL_size_t(TINY_HTTP_DATE_LENGTH, tiny_getHttpDate(&date, 0, buffer, sizeof(buffer)));
+  TEST_ASSERT_EQUAL_STRING("Thu, 01 Jan 1970 00:00:00 GMT", buffer);
+  const uint32_t sequence = date.sequence;
+  const tinyUnixType nows[] = {784111777, 784111777, 784111778, 4294967296, 4294967296, 0};
+  for (size_t i = 0; i < sizeof(nows) / sizeof(nows[0]); i++) {
+    tiny_formatHttpDate(expected, sizeof(expected), nows[i]);
+    TEST_ASSERT_EQUAL_size_t(TINY_HTTP_DATE_LENGTH, tiny_getHttpDate(&date, nows[i], buffer, sizeof(buffer)));
+    TEST_ASSERT_EQUAL_STRING(expected, buffer);
+    TEST_ASSERT_EQUAL_STRING(expected, (const char *)date.words);
+  }
+  // Only new seconds are published
+  TEST_ASSERT_EQUAL_UINT32(sequence + 8U, date.sequence);
+  // Concurrent update formats without publishing
+  date.sequence++;
+  TEST_ASSERT_EQUAL_size_t(TINY_HTTP_DATE_LENGTH, tiny_getHttpDate(&date, 784111777, buffer, sizeof(buffer)));
+  TEST_ASSERT_EQUAL_STRING("Sun, 06 Nov 1994 08:49:37 GMT", buffer);
+  TEST_ASSERT_EQUAL_STRING("Thu, 01 Jan 1970 00:00:00 GMT", (const char *)date.words);
+  // Check invalid arguments
+  TEST_ASSERT_EQUAL_size_t(0, tiny_getHttpDate(&date, 0, buffer, TINY_HTTP_DATE_LENGTH));
+  TEST_ASSERT_EQUAL_size_t(0, tiny_getHttpDate(&date, 253402300800, buffer, sizeof(buffer)));
+  TEST_ASSERT_EQUAL_size_t(0, tiny_getHttpDate(NULL, 0, buffer, sizeof(buffer)));
+  TEST_ASSERT_EQUAL_size_t(0, tiny_getHttpDate(&date, 0, NULL, sizeof(buffer)));
+  TEST_ASSERT_EQUAL_size_t(0, tiny_getHttpDate(&date, 0, buffer, 0));
+  tiny_initHttpDate(NULL);
+}
+
+void test_formatBatch(void) {
+  // Several chunks with five digit years and a tail
+  tinyUnixType unixTimes[75];
+  for (size_t i = 0; i < sizeof(unixTimes) / sizeof(unixTimes[0]); i++) {
+    unixTimes[i] = (tinyUnixType)i * 3456789013U;
+  }
+  const size_t count = sizeof(unixTimes) / sizeof(unixTimes[0]);
+  const size_t stride = TINY_FORMAT_LENGTH + 2;
+  char rows[sizeof(unixTimes) / sizeof(unixTimes[0]) * (TINY_FORMAT_LENGTH + 2)];
+  uint8_t invalidMap[(sizeof(unixTimes) / sizeof(unixTimes[0]) + 7) / 8];
+  memset(rows, '|', sizeof(rows));
+  size_t invalidCount = 0;
+  tinyTimeType timeType;
+  for (size_t i = 0; i < count; i++) {
+    invalidCount += unixTimes[i] > 253402300799U;
+  }
+  TEST_ASSERT_EQUAL_size_t(invalidCount, tiny_formatBatch(rows, stride, unixTimes, count, invalidMap));
+  TEST_ASSERT_EQUAL_size_t(invalidCount, tiny_formatBatch(rows, stride, unixTimes, count, NULL));
+  for (size_t i = 0; i < count; i++) {
+    const bool isInvalid = unixTimes[i] > 253402300799U;
+    tiny_getTimeType(&timeType, unixTimes[i]);
+    TEST_ASSERT_EQUAL_UINT8(isInvalid, (invalidMap[i / 8] >> (i % 8)) & 1U);
+    if (isInvalid) {
+      TEST_ASSERT_EACH_EQUAL_CHAR(' ', &rows[i * stride], TINY_FORMAT_LENGTH);
+    } else {
+      TEST_ASSERT_EQUAL_CHAR_ARRAY(tiny_getFormat(&timeType), &rows[i * stride], TINY_FORMAT_LENGTH);
+    }
+    TEST_ASSERT_EQUAL_CHAR_ARRAY("||", &rows[i * stride + TINY_FORMAT_LENGTH], 2);
+  }
+
+  // Arrow like offsets with variable lengths
+  char data[sizeof(unixTimes) / sizeof(unixTimes[0]) * (TINY_FORMAT_LENGTH + 1)];
+  int32_t offsets[sizeof(unixTimes) / sizeof(unixTimes[0]) + 1];
+  TEST_ASSERT_EQUAL_size_t(count, tiny_formatBatchOffsets(data, sizeof(data), offsets, unixTimes, count));
+  TEST_ASSERT_EQUAL_INT32(0, offsets[0]);
+  for (size_t i = 0; i < count; i++) {
+    tiny_getTimeType(&timeType, unixTimes[i]);
+    const char *expected = tiny_getFormat(&timeType);
+    TEST_ASSERT_EQUAL_INT32(offsets[i] + (int32_t)strlen(expected), offsets[i + 1]);
+    TEST_ASSERT_EQUAL_CHAR_ARRAY(expected, &data[offsets[i]], strlen(expected));
+  }
+  // Full data buffer, five digit year does not fit
+  TEST_ASSERT_EQUAL_size_t(2, tiny_formatBatchOffsets(data, 2 * TINY_FORMAT_LENGTH + 1, offsets, unixTimes, count));
+  TEST_ASSERT_EQUAL_size_t(2, tiny_formatBatchOffsets(data, 2 * TINY_FORMAT_LENGTH + 1, offsets, &unixTimes[73], 2));
+  TEST_ASSERT_EQUAL_INT32(2 * TINY_FORMAT_LENGTH + 1, offsets[2]);
+  TEST_ASSERT_EQUAL_size_t(1, tiny_formatBatchOffsets(data, 2 * TINY_FORMAT_LENGTH, offsets, &unixTimes[73], 2));
+  TEST_ASSERT_EQUAL_INT32(TINY_FORMAT_LENGTH, offsets[1]);
+  TEST_ASSERT_EQUAL_size_t(0, tiny_formatBatchOffsets(data, 0, offsets, unixTimes, count));
+  TEST_ASSERT_EQUAL_size_t(0, tiny_formatBatchOffsets(data, sizeof(data), offsets, unixTimes, 0));
+  TEST_ASSERT_EQUAL_INT32(0, offsets[0]);
+  // Check invalid arguments
+  TEST_ASSERT_EQUAL_size_t(count, tiny_formatBatch(NULL, stride, unixTimes, count, invalidMap));
+  TEST_ASSERT_EQUAL_size_t(count, tiny_formatBatch(rows, stride, NULL, count, invalidMap));
+  TEST_ASSERT_EQUAL_size_t(count, tiny_formatBatch(rows, TINY_FORMAT_LENGTH - 1, unixTimes, count, invalidMap));
+  TEST_ASSERT_EQUAL_size_t(0, tiny_formatBatchOffsets(NULL, sizeof(data), offsets, unixTimes, count));
+  TEST_ASSERT_EQUAL_size_t(0, tiny_formatBatchOffsets(data, sizeof(data), NULL, unixTimes, count));
+  TEST_ASSERT_EQUAL_size_t(0, tiny_formatBatchOffsets(data, sizeof(data), offsets, NULL, count));
+}
+
+void test_formatBatchSimd(void) {
+#define FORMAT_SIMD_CHUNK (1001U) // Odd to leave a tail for the scalar rows
+  static tinyUnixType unixTimes[FORMAT_SIMD_CHUNK];
+  static char rows[FORMAT_SIMD_CHUNK * TINY_FORMAT_BUFFER_SIZE];
+  tinyTimeType timeType;
+  for (uint8_t level = TINY_SIMD_NONE; level < TINY_MAX_SIMD_LEVELS; level++) {
+    if (level != (uint8_t)tiny_setSimdLevel((TINY_SIMD_LEVELS)level)) {
+      continue; // Not supported by this CPU
+    }
+    // All days of the four digit years, some rows after the year 9999
+    for (uint64_t firstDay = 0; firstDay < 2932897U; firstDay += FORMAT_SIMD_CHUNK) {
+      for (uint32_t i = 0; i < FORMAT_SIMD_CHUNK; i++) {
+        const uint64_t day = firstDay + i;
+        unixTimes[i] = day * TINY_ONE_DAY_IN_SEC + (day * 7919U) % TINY_ONE_DAY_IN_SEC;
+        if (0 == day % 1009U) {
+          unixTimes[i] = 253402300800U + day;
+        }
+      }
+      tiny_formatBatch(rows, TINY_FORMAT_BUFFER_SIZE, unixTimes, FORMAT_SIMD_CHUNK, NULL);
+      for (uint32_t i = 0; i < FORMAT_SIMD_CHUNK; i++) {
+        if (unixTimes[i] > 253402300799U) {
+          TEST_ASSERT_EACH_EQUAL_CHAR(' ', &rows[i * TINY_FORMAT_BUFFER_SIZE], TINY_FORMAT_LENGTH);
+        } else {
+          tiny_getTimeType(&timeType, unixTimes[i]);
+          TEST_ASSERT_EQUAL_CHAR_ARRAY(tiny_getFormat(&timeType), &rows[i * TINY_FORMAT_BUFFER_SIZE], TINY_FORMAT_LENGTH);
+        }
+      }
+    }
+  }
+  // Restore the best level
+  tiny_setSimdLevel(TINY_MAX_SIMD_LEVELS);
+}
+
+void test_parseFormat(void) {
+  // Zero padding bytes for the memory compares
+  tinyTimeType timeType;
+  tinyTimeType expected;
+  memset(&timeType, 0, sizeof(timeType));
+  memset(&expected, 0, sizeof(expected));
+  for (size_t i = 1; i < sizeof(testTimes) / sizeof(testTimes[0]); i++) {
+    TEST_ASSERT_EQUAL_UINT8(1, tiny_parseFormat(testTimes[i].formatString, TINY_FORMAT_LENGTH, &timeType));
+    TEST_ASSERT_EQUAL_MEMORY(&testTimes[i].timeType, &timeType, sizeof(timeType));
+    TEST_ASSERT_EQUAL_UINT64(testTimes[i].unixTime, tiny_getUnixTime(&timeType));
+  }
+  // Round trip of the format until the year 9999
+  char buffer[TINY_FORMAT_BUFFER_SIZE];
+  for (tinyUnixType unixTime = 0; unixTime <= 253402300799U; unixTime += 7777777U) {
+    tiny_getTimeType(&expected, unixTime);
+    tiny_formatTo(buffer, sizeof(buffer), &expected);
+    TEST_ASSERT_EQUAL_UINT8(1, tiny_parseFormat(buffer, TINY_FORMAT_LENGTH, &timeType));
+    TEST_ASSERT_EQUAL_MEMORY(&expected, &timeType, sizeof(timeType));
+    TEST_ASSERT_EQUAL_UINT64(unixTime, tiny_getUnixTime(&timeType));
+  }
+  // Following characters are ignored
+  TEST_ASSERT_EQUAL_UINT8(1, tiny_parseFormat("Fri 31 Dec 9999 23:59:59 log", 28, &timeType));
+  TEST_ASSERT_EQUAL_UINT64(253402300799U, tiny_getUnixTime(&timeType));
+  // Leap day of a year divisible by 400
+  TEST_ASSERT_EQUAL_UINT8(1, tiny_parseFormat("Tue 29 Feb 2000 00:00:00", TINY_FORMAT_LENGTH, &timeType));
+  TEST_ASSERT_EQUAL_UINT64(951782400U, tiny_getUnixTime(&timeType));
+  // Wrong layouts, dates and weekdays do not change the time type
+  const char *wrongStrings[] = {
+      "Fri  1 Jan 1970 00:00:00", "Thu 01 Jan 1970 00:00:00", "Thu  0 Jan 1970 00:00:00",
+      "Wed 31 Dec 1969 23:59:59", "Fri 32 Jan 2038 00:00:00", "Sat 29 Feb 2025 00:00:00",
+      "Thu  1 Jan 1970 24:00:00", "Thu  1 Jan 1970 00:60:00", "Thu  1 Jan 1970 00:00:60",
+      "Thu  1 jan 1970 00:00:00", "thu  1 Jan 1970 00:00:00", "Thu  1 Jxn 1970 00:00:00",
+      "Xyz  1 Jan 1970 00:00:00", "Thu  1 Jan 1970 00-00:00", "Thu  1 Jan 1970T00:00:00",
+      "Thu  1 Jan 197a 00:00:00", "Thu  1 Jan 1970 0 :00:00", "Thu  a Jan 1970 00:00:00",
+      "Thu 1  Jan 1970 00:00:00", "Thu,  1 Jan 1970 00:00:0", "Sat  1 Jan 10000 00:00:0",
+      "Mon 29 Feb 2100 00:00:00", "Sun 29 Feb 2100 00:00:00", "Thu  1 Jan 1970 99:00:00"};
+  memset(&expected, 0xA5, sizeof(expected));
+  timeType = expected;
+  for (size_t i = 0; i < sizeof(wrongStrings) / sizeof(wrongStrings[0]); i++) {
+    TEST_ASSERT_EQUAL_UINT8(0, tiny_parseFormat(wrongStrings[i], strlen(wrongStrings[i]), &timeType));
+    TEST_ASSERT_EQUAL_MEMORY(&expected, &timeType, sizeof(timeType));
+  }
+  // Check invalid arguments
+  TEST_ASSERT_EQUAL_UINT8(0, tiny_parseFormat(testTimes[1].formatString, TINY_FORMAT_LENGTH - 1, &timeType));
+  TEST_ASSERT_EQUAL_UINT8(0, tiny_parseFormat(NULL, TINY_FORMAT_LENGTH, &timeType));
+  TEST_ASSERT_EQUAL_UINT8(0, tiny_parseFormat(testTimes[1].formatString, TINY_FORMAT_LENGTH, NULL));
+}
+
+void test_parseCached(void) {
+  tinyParseCacheType cache;
+  tiny_initParseCache(&cache);
+  tinyUnixType unixTime = 0;
+  uint32_t nanoSec = 0;
+  int16_t offsetMin = 0;
+  // Same results as the uncached parsers for hits and misses of the date
+  char buffer[TINY_RFC3339_BUFFER_SIZE];
+  tinyTimeType timeType;
+  for (tinyUnixType expected = 0; expected <= 253402300799U; expected += (expected % 7) ? 4321U : 7777777U) {
+    tiny_getTimeType(&timeType, expected);
+    tiny_formatTo(buffer, sizeof(buffer), &timeType);
+    TEST_ASSERT_EQUAL_UINT8(1, tiny_parseFormatCached(&cache, buffer, TINY_FORMAT_LENGTH, &unixTime));
+    TEST_ASSERT_EQUAL_UINT64(expected, unixTime);
+  }
+  const int16_t offsets[] = {0, 345, -720};
+  for (tinyUnixType expected = 86400; expected <= 253402300799U - 86400U; expected += (expected % 7) ? 4321U : 7777777U) {
+    const int16_t offset = offsets[expected % 3];
+    const size_t length = tiny_formatRfc3339(buffer, sizeof(buffer), expected, 123000000U, 3, offset);
+    TEST_ASSERT_EQUAL_size_t(length, tiny_parseRfc3339Cached(&cache, buffer, length, &unixTime, &nanoSec, &offsetMin));
+    TEST_ASSERT_EQUAL_UINT64(expected, unixTime);
+    TEST_ASSERT_EQUAL_UINT32(123000000U, nanoSec);
+    TEST_ASSERT_EQUAL_INT16(offset, offsetMin);
+  }
+  // Invalid times and zones of a cached date
+  TEST_ASSERT_EQUAL_size_t(20, tiny_parseRfc3339Cached(&cache, "1970-01-01T01:00:00Z", 20, &unixTime, NULL, NULL));
+  TEST_ASSERT_EQUAL_UINT64(3600, unixTime);
+  const char *wrongRfc3339[] = {"1970-01-01T24:00:00Z", "1970-01-01T00:60:00Z", "1970-01-01T00:00:60Z",
+                                "1970-01-01T00-00:00Z", "1970-01-01T0a:00:00Z", "1970-01-01T00:59:59+01:00",
+                                "1970-01-01T01:00:00.Z", "1970-01-01T01:00:00"};
+  for (size_t i = 0; i < sizeof(wrongRfc3339) / sizeof(wrongRfc3339[0]); i++) {
+    TEST_ASSERT_EQUAL_size_t(0, tiny_parseRfc3339Cached(&cache, wrongRfc3339[i], strlen(wrongRfc3339[i]), &unixTime,
+                                                        NULL, NULL));
+    TEST_ASSERT_EQUAL_UINT64(3600, unixTime);
+  }
+  TEST_ASSERT_EQUAL_UINT8(1, tiny_parseFormatCached(&cache, "Thu  1 Jan 1970 01:00:00", 24, &unixTime));
+  const char *wrongFormat[] = {"Thu  1 Jan 1970 24:00:00", "Thu  1 Jan 1970 00:60:00", "Thu  1 Jan 1970 00:00:60",
+                               "Thu  1 Jan 1970 00-00:00", "Thu  1 Jan 1970 0 :00:00", "Fri  1 Jan 1970 00:00:00"};
+  for (size_t i = 0; i < sizeof(wrongFormat) / sizeof(wrongFormat[0]); i++) {
+    TEST_ASSERT_EQUAL_UINT8(0, tiny_parseFormatCached(&cache, wrongFormat[i], TINY_FORMAT_LENGTH, &unixTime));
+    TEST_ASSERT_EQUAL_UINT64(3600, unixTime);
+  }
+  // An empty cache never matches
+  tiny_initParseCache(&cache);
+  memset(buffer, 0, sizeof(buffer));
+  memcpy(&buffer[16], "00:00:00", 8);
+  TEST_ASSERT_EQUAL_UINT8(0, tiny_parseFormatCached(&cache, buffer, TINY_FORMAT_LENGTH, &unixTime));
+  // Check invalid arguments
+  TEST_ASSERT_EQUAL_UINT8(0, tiny_parseFormatCached(NULL, testTimes[1].formatString, TINY_FORMAT_LENGTH, &unixTime));
+  TEST_ASSERT_EQUAL_UINT8(0, tiny_parseFormatCached(&cache, testTimes[1].formatString, TINY_FORMAT_LENGTH - 1, &unixTime));
+  TEST_ASSERT_EQUAL_UINT8(0, tiny_parseFormatCached(&cache, NULL, TINY_FORMAT_LENGTH, &unixTime));
+  TEST_ASSERT_EQUAL_UINT8(0, tiny_parseFormatCached(&cache, testTimes[1].formatString, TINY_FORMAT_LENGTH, NULL));
+  TEST_ASSERT_EQUAL_size_t(0, tiny_parseRfc3339Cached(NULL, "1970-01-01T01:00:00Z", 20, &unixTime, NULL, NULL));
+  TEST_ASSERT_EQUAL_size_t(0, tiny_parseRfc3339Cached(&cache, "1970-01-01T01:00:00Z", 19, &unixTime, NULL, NULL));
+  TEST_ASSERT_EQUAL_size_t(0, tiny_parseRfc3339Cached(&cache, NULL, 20, &unixTime, NULL, NULL));
+  TEST_ASSERT_EQUAL_size_t(0, tiny_parseRfc3339Cached(&cache, "1970-01-01T01:00:00Z", 20, NULL, NULL, NULL));
+}
+
+void test_parseStream(void) {
+  const char *stream = "2025-03-21T12:34:56.123456Z GET /index.html\n"
+                       "Fri 21 Mar 2025 12:34:57 worker started\n"
+                       "\n"
+                       "no timestamp in this line\n"
+                       "2025-03-21T12:35:00+01:00 a message longer than the window of the line start\n"
+                       "2025-03-21T12:35:01Z\r\n"
+                       "Fri 21 Mar 2025 12:34:58";
+  const tinyUnixType expected[] = {1742560496U, 1742560497U, UINT64_MAX,  UINT64_MAX,
+                                   1742556900U, 1742560501U, 1742560498U};
+  const size_t lines = sizeof(expected) / sizeof(expected[0]);
+  const size_t len = strlen(stream);
+  tinyStreamParserType parser;
+  tinyUnixType unixTimes[8];
+  size_t used = 0;
+  // Same times for chunks of any size
+  for (size_t chunk = 1; chunk <= len; chunk++) {
+    tiny_initStreamParser(&parser);
+    size_t parsed = 0;
+    for (size_t pos = 0; pos < len; pos += chunk) {
+      const size_t chunkLen = len - pos < chunk ? len - pos : chunk;
+      parsed += tiny_parseStream(&parser, &unixTimes[parsed], lines - parsed, &stream[pos], chunkLen, &used);
+      TEST_ASSERT_EQUAL_size_t(chunkLen, used);
+    }
+    TEST_ASSERT_EQUAL_size_t(lines - 1, parsed);
+    TEST_ASSERT_EQUAL_UINT8(1, tiny_finishStream(&parser, &unixTimes[parsed]));
+    TEST_ASSERT_EQUAL_UINT64_ARRAY(expected, unixTimes, lines);
+    TEST_ASSERT_EQUAL_UINT8(0, tiny_finishStream(&parser, &unixTimes[parsed]));
+  }
+  // A full array stops the parser, the rest of the chunk is fed again
+  tiny_initStreamParser(&parser);
+  size_t pos = 0;
+  for (size_t i = 0; i < lines - 1; i++) {
+    TEST_ASSERT_EQUAL_size_t(1, tiny_parseStream(&parser, &unixTimes[i], 1, &stream[pos], len - pos, &used));
+    TEST_ASSERT_EQUAL_UINT64(expected[i], unixTimes[i]);
+    pos += used;
+  }
+  TEST_ASSERT_EQUAL_size_t(0, tiny_parseStream(&parser, unixTimes, 0, &stream[pos], len - pos, &used));
+  TEST_ASSERT_EQUAL_size_t(0, used);
+  TEST_ASSERT_EQUAL_size_t(0, tiny_parseStream(&parser, unixTimes, 1, &stream[pos], len - pos, &used));
+  TEST_ASSERT_EQUAL_size_t(len - pos, used);
+  TEST_ASSERT_EQUAL_UINT8(1, tiny_finishStream(&parser, &unixTimes[0]));
+  TEST_ASSERT_EQUAL_UINT64(expected[lines - 1], unixTimes[0]);
+  // Check invalid arguments
+  TEST_ASSERT_EQUAL_size_t(0, tiny_parseStream(NULL, unixTimes, 1, stream, len, &used));
+  TEST_ASSERT_EQUAL_size_t(0, tiny_parseStream(&parser, NULL, 1, stream, len, &used));
+  TEST_ASSERT_EQUAL_size_t(0, tiny_parseStream(&parser, unixTimes, 1, NULL, len, &used));
+  TEST_ASSERT_EQUAL_size_t(0, tiny_parseStream(&parser, unixTimes, 1, stream, len, NULL));
+  TEST_ASSERT_EQUAL_UINT8(0, tiny_finishStream(NULL, unixTimes));
+  TEST_ASSERT_EQUAL_UINT8(0, tiny_finishStream(&parser, NULL));
+}
+
+/**
+ * @brief Writes the syslog timestamp "Mmm dd hh:mm:ss" of a unix time.
+ *
+ * @param buf Buffer of at least TINY_SYSLOG_LENGTH characters
+ * @param unixTime The unix time until the year 9999
+ */
+static void writeSyslog(char *buf, const tinyUnixType unixTime) {
+  tinyTimeType timeType;
+  char format[TINY_FORMAT_BUFFER_SIZE];
+  tiny_getTimeType(&timeType, unixTime);
+  tiny_formatTo(format, sizeof(format), &timeType);
+  memcpy(buf, &format[7], 4);
+  memcpy(&buf[4], &format[4], 3);
+  memcpy(&buf[7], &format[16], 8);
+}
+
+void test_parseSyslog(void) {
+  // Zero padding bytes for the memory compares
+  tinyTimeType timeType;
+  tinyTimeType expected;
+  memset(&timeType, 0, sizeof(timeType));
+  memset(&expected, 0, sizeof(expected));
+  typedef struct {
+    const char *syslog;
+    tinyUnixType refTime;
+    tinyUnixType unixTime;
+  } syslogTestCase;
+  const syslogTestCase tests[] = {
+      {"Mar 21 12:34:56", 1711022400U, 1711024496U}, // Same month
+      {"Apr 21 12:34:56", 1711022400U, 1713702896U}, // One month ahead
+      {"May 21 12:34:56", 1711022400U, 1684672496U}, // Previous year
+      {"Mar  1 00:00:00", 1711022400U, 1709251200U}, // Padded month day
+      {"Feb 29 00:00:00", 1711022400U, 1709164800U}, // Leap day
+      {"Dec 31 23:59:50", 1735689605U, 1735689590U}, // Rollover at new year
+      {"Jan  1 00:00:10", 1735689590U, 1735689610U}, // Sender clock ahead
+      {"Jan  1 00:00:00 host app: log", 0U, 0U}};    // Ignore the message
+  for (size_t i = 0; i < sizeof(tests) / sizeof(tests[0]); i++) {
+    TEST_ASSERT_EQUAL_UINT8(1, tiny_parseSyslog(tests[i].syslog, strlen(tests[i].syslog), tests[i].refTime, &timeType));
+    tiny_getTimeType(&expected, tests[i].unixTime);
+    TEST_ASSERT_EQUAL_MEMORY(&expected, &timeType, sizeof(timeType));
+  }
+  // Round trip with the time as reference
+  char buffer[TINY_SYSLOG_LENGTH];
+  for (tinyUnixType unixTime = 0; unixTime <= 253402300799U; unixTime += 7777777U) {
+    writeSyslog(buffer, unixTime);
+    tiny_getTimeType(&expected, unixTime);
+    TEST_ASSERT_EQUAL_UINT8(1, tiny_parseSyslog(buffer, sizeof(buffer), unixTime, &timeType));
+    TEST_ASSERT_EQUAL_MEMORY(&expected, &timeType, sizeof(timeType));
+  }
+  // Wrong layouts, dates and years before 1970 do not change the time type
+  const char *wrongStrings[] = {"Mar 01 12:34:56", "Mar  0 12:34:56", "Apr 31 12:34:56", "Mar 21 24:00:00",
+                                "Mar 21 12:60:00", "Mar 21 12:00:60", "mar 21 12:34:56", "Mxr 21 12:34:56",
+                                "Mar 21 12-34:56", "Mar 21T12:34:56", "Mar 2a 12:34:56", "Mar 21 12:34:5",
+                                "Mar 21  2:34:56", "Mar 21,12:34:56"};
+  memset(&expected, 0xA5, sizeof(expected));
+  timeType = expected;
+  for (size_t i = 0; i < sizeof(wrongStrings) / sizeof(wrongStrings[0]); i++) {
+    TEST_ASSERT_EQUAL_UINT8(0, tiny_parseSyslog(wrongStrings[i], strlen(wrongStrings[i]), 1711022400U, &timeType));
+    TEST_ASSERT_EQUAL_MEMORY(&expected, &timeType, sizeof(timeType));
+  }
+  // No leap day in 2025 and no year before the unix epoch
+  TEST_ASSERT_EQUAL_UINT8(0, tiny_parseSyslog("Feb 29 00:00:00", TINY_SYSLOG_LENGTH, 1741003200U, &timeType));
+  TEST_ASSERT_EQUAL_UINT8(0, tiny_parseSyslog("Dec 31 23:59:59", TINY_SYSLOG_LENGTH, 0U, &timeType));
+  TEST_ASSERT_EQUAL_MEMORY(&expected, &timeType, sizeof(timeType));
+  // Check invalid arguments
+  TEST_ASSERT_EQUAL_UINT8(0, tiny_parseSyslog("Mar 21 12:34:56", TINY_SYSLOG_LENGTH - 1, 0U, &timeType));
+  TEST_ASSERT_EQUAL_UINT8(0, tiny_parseSyslog(NULL, TINY_SYSLOG_LENGTH, 0U, &timeType));
+  TEST_ASSERT_EQUAL_UINT8(0, tiny_parseSyslog("Mar 21 12:34:56", TINY_SYSLOG_LENGTH, 0U, NULL));
+}
+
+void test_parseSyslogBatch(void) {
+#define SYSLOG_LINES (10U)
+  const char *lines[SYSLOG_LINES] = {"Dec 31 23:59:50 a", "Dec 31 23:59:59", "Jan  1 00:00:00", "Jan  1 00:00:0",
+                                     "Xyz  1 00:00:00",   "Feb 29 00:00:00", "Feb 28 12:00:00", "Mar  1 00:00:00",
+                                     "Jan 32 00:00:00",   "Jan  2 03:04:05"};
+  const tinyUnixType expected[SYSLOG_LINES] = {1735689590U, 1735689599U, 1735689600U, UINT64_MAX, UINT64_MAX,
+                                               UINT64_MAX,  1740744000U, 1709251200U, UINT64_MAX, 1735787045U};
+  char data[SYSLOG_LINES * 20U];
+  int32_t offsets[SYSLOG_LINES + 1] = {0};
+  for (size_t i = 0; i < SYSLOG_LINES; i++) {
+    const size_t len = strlen(lines[i]);
+    memcpy(&data[offsets[i]], lines[i], len);
+    offsets[i + 1] = offsets[i] + (int32_t)len;
+  }
+  // Reference in the new year, the december lines are from the year before
+  tinyUnixType unixTimes[SYSLOG_LINES];
+  uint8_t invalidMap[(SYSLOG_LINES + 7) / 8];
+  TEST_ASSERT_EQUAL_size_t(4, tiny_parseSyslogBatch(unixTimes, data, offsets, SYSLOG_LINES, 1735787045U, invalidMap));
+  TEST_ASSERT_EQUAL_UINT64_ARRAY(expected, unixTimes, SYSLOG_LINES);
+  TEST_ASSERT_EQUAL_HEX8(0x38, invalidMap[0]);
+  TEST_ASSERT_EQUAL_HEX8(0x01, invalidMap[1]);
+  // Same results as the single line parser
+  tinyTimeType timeType;
+  for (size_t i = 0; i < SYSLOG_LINES; i++) {
+    if (tiny_parseSyslog(&data[offsets[i]], (size_t)(offsets[i + 1] - offsets[i]), 1735787045U, &timeType)) {
+      TEST_ASSERT_EQUAL_UINT64(tiny_getUnixTime(&timeType), unixTimes[i]);
+    } else {
+      TEST_ASSERT_EQUAL_UINT64(UINT64_MAX, unixTimes[i]);
+    }
+  }
+  // Check invalid arguments
+  TEST_ASSERT_EQUAL_size_t(SYSLOG_LINES, tiny_parseSyslogBatch(NULL, data, offsets, SYSLOG_LINES, 0U, NULL));
+  TEST_ASSERT_EQUAL_size_t(SYSLOG_LINES, tiny_parseSyslogBatch(unixTimes, NULL, offsets, SYSLOG_LINES, 0U, NULL));
+  TEST_ASSERT_EQUAL_size_t(SYSLOG_LINES, tiny_parseSyslogBatch(unixTimes, data, NULL, SYSLOG_LINES, 0U, NULL));
+  TEST_ASSERT_EQUAL_size_t(0, tiny_parseSyslogBatch(unixTimes, data, offsets, 0, 0U, NULL));
+}
+
+void test_parseEpoch(void) {
+  typedef struct {
+    const char *epoch;
+    TINY_EPOCH_UNITS unit;
+    tinyUnixType unixTime;
+    uint32_t nanoSec;
+  } epochTestCase;
+  const epochTestCase tests[] = {
+      {"0", TINY_EPOCH_AUTO, 0U, 0U},
+      {"1711024496", TINY_EPOCH_AUTO, 1711024496U, 0U},
+      {"1711024496123", TINY_EPOCH_AUTO, 1711024496U, 123000000U},
+      {"1711024496123456", TINY_EPOCH_AUTO, 1711024496U, 123456000U},
+      {"1711024496123456789", TINY_EPOCH_AUTO, 1711024496U, 123456789U},
+      {"99999999999", TINY_EPOCH_AUTO, 99999999999U, 0U},
+      {"100000000000", TINY_EPOCH_AUTO, 100000000U, 0U},
+      {"99999999999999999", TINY_EPOCH_AUTO, 99999999999U, 999999000U},
+      {"100000000000000000", TINY_EPOCH_AUTO, 100000000U, 0U},
+      {"18446744073709551615", TINY_EPOCH_AUTO, 18446744073U, 709551615U},
+      {"18446744073709551615", TINY_EPOCH_SEC, UINT64_MAX, 0U},
+      {"18446744073709551615", TINY_EPOCH_MILLI, 18446744073709551U, 615000000U},
+      {"1711024496", TINY_EPOCH_MILLI, 1711024U, 496000000U},
+      {"1711024496", TINY_EPOCH_MICRO, 1711U, 24496000U},
+      {"1711024496", TINY_EPOCH_NANO, 1U, 711024496U},
+      {"7", TINY_EPOCH_NANO, 0U, 7U},
+      {"00000000000000000001", TINY_EPOCH_SEC, 1U, 0U},
+      {"1711024496,host", TINY_EPOCH_AUTO, 1711024496U, 0U},
+      {"12345678 ", TINY_EPOCH_AUTO, 12345678U, 0U},
+      {"123456789012345678/", TINY_EPOCH_MICRO, 123456789012U, 345678000U}};
+  for (size_t i = 0; i < sizeof(tests) / sizeof(tests[0]); i++) {
+    uint32_t nanoSec = UINT32_MAX;
+    TEST_ASSERT_EQUAL_UINT64(tests[i].unixTime,
+                             tiny_parseEpoch(tests[i].epoch, strlen(tests[i].epoch), tests[i].unit, &nanoSec));
+    TEST_ASSERT_EQUAL_UINT32(tests[i].nanoSec, nanoSec);
+  }
+  // All digit counts and units against the division
+  char buffer[24];
+  uint64_t value = 0;
+  const uint64_t scales[TINY_MAX_EPOCH_UNITS] = {1U, 1U, 1000U, 1000000U, 1000000000U};
+  for (uint8_t digits = 1; digits < 20; digits++) {
+    value = value * 10U + digits % 10U;
+    snprintf(buffer, sizeof(buffer), "%llu", (unsigned long long)value);
+    for (uint8_t unit = TINY_EPOCH_SEC; unit < TINY_MAX_EPOCH_UNITS; unit++) {
+      uint32_t nanoSec;
+      TEST_ASSERT_EQUAL_UINT64(value / scales[unit], tiny_parseEpoch(buffer, digits, (TINY_EPOCH_UNITS)unit, &nanoSec));
+      TEST_ASSERT_EQUAL_UINT32((uint32_t)(value % scales[unit] * (1000000000U / scales[unit])), nanoSec);
+    }
+  }
+  // Overflows, missing digits and invalid arguments leave the nanoseconds
+  const char *wrongStrings[] = {"18446744073709551616", "99999999999999999999", "123456789012345678901", "", "x1",
+                                " 1",                   "-1",                   "+1"};
+  uint32_t nanoSec = 42U;
+  for (size_t i = 0; i < sizeof(wrongStrings) / sizeof(wrongStrings[0]); i++) {
+    TEST_ASSERT_EQUAL_UINT64(UINT64_MAX,
+                             tiny_parseEpoch(wrongStrings[i], strlen(wrongStrings[i]), TINY_EPOCH_AUTO, &nanoSec));
+  }
+  TEST_ASSERT_EQUAL_UINT64(UINT64_MAX, tiny_parseEpoch(NULL, 1, TINY_EPOCH_AUTO, &nanoSec));
+  TEST_ASSERT_EQUAL_UINT64(UINT64_MAX, tiny_parseEpoch("1", 1, TINY_MAX_EPOCH_UNITS, &nanoSec));
+  TEST_ASSERT_EQUAL_UINT32(42U, nanoSec);
+  // The length limits the digits
+  TEST_ASSERT_EQUAL_UINT64(1711U, tiny_parseEpoch("1711024496", 4, TINY_EPOCH_AUTO, NULL));
+}
+
+void test_parseProgram(void) {
+  typedef struct {
+    const char *pattern;
+    const char *str;
+    tinyUnixType unixTime;
+    size_t parsed;
+  } parseTestCase;
+  const parseTestCase tests[] = {
+      {"%d/%b/%Y:%H:%M:%S %z", "10/Oct/2000:13:55:36 -0700] \"GET /\"", 971211336U, 26},
+      {"%F %T", "2024-03-21 12:34:56", 1711024496U, 19},
+      {"%FT%T%z", "2024-03-21T12:34:56+0200", 1711017296U, 24},
+      {"%c", "Thu Mar 21 12:34:56 2024", 1711024496U, 24},
+      {"%c", "fri MAR  1 00:00:00 2024", 1709251200U, 24},
+      {"%a %d %b %Y %T", "Thu 21 Mar 2024 12:34:56", 1711024496U, 24},
+      {"%A, %d %B %Y %I:%M %p", "Thursday, 21 March 2024 12:34 PM", 1711024440U, 32},
+      {"%A, %d %B %Y %I:%M %p", "thursday, 21 MARCH 2024 12:05 am", 1710979500U, 32},
+      {"%B %e, %Y", "May  5, 2024", 1714867200U, 12},
+      {"%D", "03/21/24", 1710979200U, 8},
+      {"%x %X", "01/01/70 00:00:00", 0U, 17},
+      {"%Y%m%d%H%M%S", "20240321123456", 1711024496U, 14},
+      {"%u %w %Y-%m-%d", "4 4 2024-03-21", 1710979200U, 14},
+      {"%u %Y-%m-%d", "7 2024-03-24", 1711238400U, 12},
+      {"[%H:%M:%S]%n%%%t", "[12:00:00]\n%\t", 43200U, 13},
+      {"%Y %z", "2024 -2359", 1704153540U, 10}};
+  tinyParseProgramType prog;
+  tinyTimeType timeType;
+  tinyTimeType expected;
+  memset(&timeType, 0, sizeof(timeType));
+  memset(&expected, 0, sizeof(expected));
+  for (size_t i = 0; i < sizeof(tests) / sizeof(tests[0]); i++) {
+    TEST_ASSERT_EQUAL_UINT8(1, tiny_parseCompile(&prog, tests[i].pattern));
+    TEST_ASSERT_EQUAL_size_t(tests[i].parsed, tiny_parseRun(&prog, tests[i].str, strlen(tests[i].str), &timeType));
+    tiny_getTimeType(&expected, tests[i].unixTime);
+    TEST_ASSERT_EQUAL_MEMORY(&expected, &timeType, sizeof(timeType));
+  }
+  // Round trip with the format programs
+  const char *patterns[] = {"%a %d %b %Y %H:%M:%S", "%A %B %e %I:%M:%S %p %Y", "%F %T"};
+  tinyFormatProgramType formatProg;
+  char buffer[TINY_FORMAT_PROGRAM_LENGTH + 1];
+  for (size_t i = 0; i < sizeof(patterns) / sizeof(patterns[0]); i++) {
+    TEST_ASSERT_EQUAL_UINT8(1, tiny_parseCompile(&prog, patterns[i]));
+    TEST_ASSERT_EQUAL_UINT8(1, tiny_formatCompile(&formatProg, patterns[i]));
+    for (tinyUnixType unixTime = 0; unixTime <= 253402300799U; unixTime += 7777777U) {
+      tiny_getTimeType(&expected, unixTime);
+      const size_t length = tiny_formatRun(&formatProg, &expected, buffer, sizeof(buffer));
+      TEST_ASSERT_EQUAL_size_t(length, tiny_parseRun(&prog, buffer, length, &timeType));
+      TEST_ASSERT_EQUAL_MEMORY(&expected, &timeType, sizeof(timeType));
+    }
+  }
+  // Wrong strings do not change the time type
+  const parseTestCase wrongTests[] = {
+      {"%c", "Fri Mar 21 12:34:56 2024", 0, 0},  {"%c", "Thu Mar 21 12:34:56 202", 0, 0},
+      {"%F", "2024-02-30", 0, 0},                {"%F", "1969-12-31", 0, 0},
+      {"%F", "2024/03/21", 0, 0},                {"%F", "2024-3-21", 0, 0},
+      {"%T", "24:00:00", 0, 0},                  {"%T", "12:60:00", 0, 0},
+      {"%I %p", "13 PM", 0, 0},                  {"%I %p", "00 AM", 0, 0},
+      {"%I %p", "12 XM", 0, 0},                  {"%d %b", "01 Mxr", 0, 0},
+      {"%B %Y", "Marc 2024", 0, 0},              {"%B %Y", "Mar 2024", 0, 0},
+      {"%B %Y", "Ma", 0, 0},                     {"%A %Y", "Thursday 202", 0, 0},
+      {"%Y %z", "2024 +2400", 0, 0},             {"%Y %z", "2024 +0060", 0, 0},
+      {"%Y %z", "2024  0100", 0, 0},             {"%Y %z", "1970 +0001", 0, 0},
+      {"%u %F", "0 2024-03-24", 0, 0},           {"%w %F", "7 2024-03-24", 0, 0},
+      {"%w %F", "1 2024-03-24", 0, 0},           {"%e", "1 ", 0, 0},
+      {"%y-%m", "69-01", 0, 0}};
+  memset(&expected, 0xA5, sizeof(expected));
+  timeType = expected;
+  for (size_t i = 0; i < sizeof(wrongTests) / sizeof(wrongTests[0]); i++) {
+    TEST_ASSERT_EQUAL_UINT8(1, tiny_parseCompile(&prog, wrongTests[i].pattern));
+    TEST_ASSERT_EQUAL_size_t(0, tiny_parseRun(&prog, wrongTests[i].str, strlen(wrongTests[i].str), &timeType));
+    TEST_ASSERT_EQUAL_MEMORY(&expected, &timeType, sizeof(timeType));
+  }
+  // Unsupported conversions and program limits
+  char longPattern[TINY_PARSE_PROGRAM_LITERALS + 2];
+  memset(longPattern, '-', sizeof(longPattern) - 1);
+  longPattern[sizeof(longPattern) - 1] = '\0';
+  const char *wrongPatterns[] = {"", "%", "%Q", "%Y %j", "%C%y", "%s", longPattern,
+                                 "%a%a%a%a%a%a%a%a%a%a%a%a%a%a%a%a%a%a%a%a%a%a%a%a%a%a%a%a%a%a%a%a%a"};
+  for (size_t i = 0; i < sizeof(wrongPatterns) / sizeof(wrongPatterns[0]); i++) {
+    TEST_ASSERT_EQUAL_UINT8(0, tiny_parseCompile(&prog, wrongPatterns[i]));
+    TEST_ASSERT_EQUAL_size_t(0, tiny_parseRun(&prog, "2024", 4, &timeType));
+  }
+  // Check invalid arguments
+  TEST_ASSERT_EQUAL_UINT8(0, tiny_parseCompile(NULL, "%F"));
+  TEST_ASSERT_EQUAL_UINT8(0, tiny_parseCompile(&prog, NULL));
+  TEST_ASSERT_EQUAL_UINT8(1, tiny_parseCompile(&prog, "%F"));
+  TEST_ASSERT_EQUAL_size_t(0, tiny_parseRun(&prog, "2024-03-2", 9, &timeType));
+  TEST_ASSERT_EQUAL_size_t(0, tiny_parseRun(NULL, "2024-03-21", 10, &timeType));
+  TEST_ASSERT_EQUAL_size_t(0, tiny_parseRun(&prog, NULL, 10, &timeType));
+  TEST_ASSERT_EQUAL_size_t(0, tiny_parseRun(&prog, "2024-03-21", 10, NULL));
+  TEST_ASSERT_EQUAL_MEMORY(&expected, &timeType, sizeof(timeType));
+}
+
 void test_convertSeconds(void) {
 
   typedef struct {
@@ -241,7 +1459,10 @@ void test_convertSeconds(void) {
       {59, true, true, true, 0, 0, 0, 59},
       {3600, false, true, false, 0, 1, 0, 0},
       {60, false, false, true, 0, 0, 1, 0},
-      {0, true, true, true, 0, 0, 0, 0}};
+      {0, true, true, true, 0, 0, 0, 0},
+      {UINT64_MAX, true, true, true, 213503982334601, 7, 0, 15},
+      {UINT64_MAX, false, true, true, 0, 5124095576030431, 0, 15},
+      {UINT64_MAX, false, false, true, 0, 0, 307445734561825860, 15}};
 
   for (size_t i = 0; i < sizeof(tests) / sizeof(tests[0]); i++) {
     convertSeconds_testCase *test = &tests[i];
@@ -269,7 +1490,33 @@ int main(void) {
   RUN_TEST(test_getMonthDays);
   RUN_TEST(test_getUnixTime);
   RUN_TEST(test_getTimeType);
+  RUN_TEST(test_getTimeTypeExhaustive);
+  RUN_TEST(test_getTimeTypeReference);
+  RUN_TEST(test_getUnixTimeBatch);
+  RUN_TEST(test_getTimeTypeBatch);
+  RUN_TEST(test_getTimeTypeBatchSimd);
+  RUN_TEST(test_getUnixTimeColumns);
+  RUN_TEST(test_convertTimeType);
   RUN_TEST(test_getFormat);
+  RUN_TEST(test_formatTo);
+  RUN_TEST(test_formatToReference);
+  RUN_TEST(test_formatUnix);
+  RUN_TEST(test_getFormatCached);
+  RUN_TEST(test_formatCompile);
+  RUN_TEST(test_formatRunReference);
+  RUN_TEST(test_formatRfc3339);
+  RUN_TEST(test_formatRfc3339Reference);
+  RUN_TEST(test_parseRfc3339);
+  RUN_TEST(test_formatHttpDate);
+  RUN_TEST(test_formatBatch);
+  RUN_TEST(test_formatBatchSimd);
+  RUN_TEST(test_parseFormat);
+  RUN_TEST(test_parseCached);
+  RUN_TEST(test_parseStream);
+  RUN_TEST(test_parseSyslog);
+  RUN_TEST(test_parseSyslogBatch);
+  RUN_TEST(test_parseEpoch);
+  RUN_TEST(test_parseProgram);
   RUN_TEST(test_convertSeconds);
   return UNITY_END();
 }
\ No newline at end of file
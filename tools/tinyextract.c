@@ -0,0 +1,412 @@
+/**
+ * @file tinyextract.c
+ * @author Adrian STEINER (steia19@bfh.ch)
+ * @brief Extracts the leading timestamps of all lines of a log file
+ * @version 0.1
+ * @date 16-10-2026
+ *
+ * @copyright (C) 2025 Adrian STEINER
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https: //www.gnu.org/licenses/>.
+ *
+ */
+
+#define _GNU_SOURCE
+
+#include "tinytime.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define EXTRACT_NO_TIME (UINT64_MAX)    ///< Column value of lines without a timestamp
+#define EXTRACT_MAX_THREADS (256U)      ///< Max number of worker threads
+#define EXTRACT_MIN_RANGE (1UL << 20)   ///< Min bytes per worker thread
+#define EXTRACT_BLOCK_RECORDS (1U << 14) ///< Records per output write
+#define EXTRACT_ISO_DASH (4U)           ///< Index of the first dash of a ISO 8601 date
+
+/**
+ * @brief Output layouts of the extractor
+ *
+ */
+typedef enum {
+  EXTRACT_COLUMN = 0, ///< One tinyUnixType per line
+  EXTRACT_INDEX,      ///< One tinyExtractIndexType per line
+} EXTRACT_MODES;
+
+/**
+ * @brief Record of the per-line offset index
+ *
+ */
+typedef struct {
+  uint64_t offset;       ///< Byte offset of the line start in the input
+  tinyUnixType unixTime; ///< Leading timestamp or EXTRACT_NO_TIME
+} tinyExtractIndexType;
+
+/**
+ * @brief Work of one thread, a range of whole lines
+ *
+ */
+typedef struct {
+  const char *data;    ///< Start of the mapped input file
+  size_t begin;        ///< Offset of the first line of the range
+  size_t end;          ///< Offset after the last line of the range
+  uint64_t firstLine;  ///< Number of lines before the range
+  uint64_t lines;      ///< Number of lines in the range
+  uint64_t timestamps; ///< Number of lines with a timestamp
+  EXTRACT_MODES mode;  ///< The output layout
+  int outFd;           ///< The output file, written with pwrite
+  int error;           ///< errno of a failed write, 0 on success
+} extractRangeType;
+
+/**
+ * @brief Parses the leading timestamp of a line.
+ *
+ * Accepts RFC 3339 timestamps and the tiny_getFormat layout.
+ *
+ * @param line The start of the line
+ * @param len The length of the line without the newline
+ * @return tinyUnixType The UTC unix time or EXTRACT_NO_TIME
+ */
+static tinyUnixType extract_parseLine(const char *line, const size_t len) {
+  tinyUnixType unixTime;
+  if (len > EXTRACT_ISO_DASH && '-' == line[EXTRACT_ISO_DASH]) {
+    if (0 != tiny_parseRfc3339(line, len, &unixTime, NULL, NULL)) {
+      return unixTime;
+    }
+    return EXTRACT_NO_TIME;
+  }
+  tinyTimeType tm;
+  if (tiny_parseFormat(line, len, &tm)) {
+    return tiny_getUnixTime(&tm);
+  }
+  return EXTRACT_NO_TIME;
+}
+
+/**
+ * @brief Counts the lines of a range, a last line without newline included.
+ *
+ * @param data The mapped input file
+ * @param begin Offset of the range start
+ * @param end Offset of the range end
+ * @return uint64_t The number of lines
+ */
+static uint64_t extract_countLines(const char *data, const size_t begin, const size_t end) {
+  uint64_t lines = 0;
+  const char *pos = data + begin;
+  const char *last = data + end;
+  while (pos < last) {
+    const char *newline = memchr(pos, '\n', (size_t)(last - pos));
+    lines++;
+    if (NULL == newline) {
+      break;
+    }
+    pos = newline + 1;
+  }
+  return lines;
+}
+
+/**
+ * @brief Writes a block of records to its position in the output file.
+ *
+ * @param range The range of the records
+ * @param block The records
+ * @param size The number of bytes to write
+ * @param offset The byte offset in the output file
+ * @return int 0 on success or the errno of the failed write
+ */
+static int extract_writeBlock(const extractRangeType *range, const void *block, size_t size, off_t offset) {
+  const char *pos = block;
+  while (size > 0) {
+    ssize_t written = pwrite(range->outFd, pos, size, offset);
+    if (written < 0) {
+      if (EINTR == errno) {
+        continue;
+      }
+      return errno;
+    }
+    pos += written;
+    size -= (size_t)written;
+    offset += written;
+  }
+  return 0;
+}
+
+/**
+ * @brief Parses all lines of a range and writes their records.
+ *
+ * The records are collected in blocks of EXTRACT_BLOCK_RECORDS, each block
+ * is written to the output at the position given by the line number.
+ *
+ * @param arg The extractRangeType of the thread
+ * @return void* NULL
+ */
+static void *extract_runRange(void *arg) {
+  extractRangeType *range = arg;
+  static _Thread_local tinyExtractIndexType block[EXTRACT_BLOCK_RECORDS];
+  tinyUnixType *column = (tinyUnixType *)block;
+  const size_t recordSize = EXTRACT_INDEX == range->mode ? sizeof(tinyExtractIndexType) : sizeof(tinyUnixType);
+  const char *pos = range->data + range->begin;
+  const char *last = range->data + range->end;
+  uint64_t line = range->firstLine;
+  size_t count = 0;
+
+  range->timestamps = 0;
+  range->error = 0;
+  while (pos < last) {
+    const char *newline = memchr(pos, '\n', (size_t)(last - pos));
+    const char *lineEnd = NULL == newline ? last : newline;
+    const tinyUnixType unixTime = extract_parseLine(pos, (size_t)(lineEnd - pos));
+    range->timestamps += EXTRACT_NO_TIME != unixTime;
+    if (EXTRACT_INDEX == range->mode) {
+      block[count].offset = (uint64_t)(pos - range->data);
+      block[count].unixTime = unixTime;
+    } else {
+      column[count] = unixTime;
+    }
+    count++;
+    if (EXTRACT_BLOCK_RECORDS == count) {
+      range->error = extract_writeBlock(range, block, count * recordSize, (off_t)(line * recordSize));
+      if (0 != range->error) {
+        return NULL;
+      }
+      line += count;
+      count = 0;
+    }
+    pos = lineEnd + 1;
+  }
+  range->error = extract_writeBlock(range, block, count * recordSize, (off_t)(line * recordSize));
+  return NULL;
+}
+
+/**
+ * @brief Splits the input into ranges of whole lines.
+ *
+ * @param ranges The ranges to fill
+ * @param count The number of wanted ranges
+ * @param data The mapped input file
+ * @param size The size of the input file
+ * @return size_t The number of ranges, less than count for small files
+ */
+static size_t extract_splitRanges(extractRangeType *ranges, size_t count, const char *data, const size_t size) {
+  if (size / EXTRACT_MIN_RANGE < count) {
+    count = size / EXTRACT_MIN_RANGE + 1;
+  }
+  size_t begin = 0;
+  size_t ranged = 0;
+  for (size_t i = 0; i < count && begin < size; i++) {
+    size_t end = size / count * (i + 1);
+    if (i + 1 == count || end <= begin) {
+      end = size;
+    } else {
+      const char *newline = memchr(data + end, '\n', size - end);
+      end = NULL == newline ? size : (size_t)(newline - data) + 1;
+    }
+    ranges[ranged].data = data;
+    ranges[ranged].begin = begin;
+    ranges[ranged].end = end;
+    ranged++;
+    begin = end;
+  }
+  return ranged;
+}
+
+/**
+ * @brief Runs a function for all ranges on their own thread.
+ *
+ * @param ranges The ranges to process
+ * @param count The number of ranges
+ * @param function The thread function
+ * @return int 0 on success, -1 if a thread could not be started
+ */
+static int extract_runThreads(extractRangeType *ranges, const size_t count, void *(*function)(void *)) {
+  pthread_t threads[EXTRACT_MAX_THREADS];
+  size_t started = 0;
+  int result = 0;
+  for (; started < count; started++) {
+    if (0 != pthread_create(&threads[started], NULL, function, &ranges[started])) {
+      result = -1;
+      break;
+    }
+  }
+  for (size_t i = 0; i < started; i++) {
+    pthread_join(threads[i], NULL);
+  }
+  return result;
+}
+
+/**
+ * @brief Counts the lines of a range, thread function.
+ *
+ * @param arg The extractRangeType to count
+ * @return void* NULL
+ */
+static void *extract_countRange(void *arg) {
+  extractRangeType *range = arg;
+  range->lines = extract_countLines(range->data, range->begin, range->end);
+  return NULL;
+}
+
+/**
+ * @brief Prints the usage of the tool.
+ *
+ * @param name The program name
+ */
+static void extract_usage(const char *name) {
+  fprintf(stderr,
+          "Usage: %s [-i] [-j threads] input output\n"
+          "  Writes the leading timestamp of every input line as packed\n"
+          "  native endian uint64 unix time column, %llu for lines without\n"
+          "  a timestamp. Accepts RFC 3339 and the tiny_getFormat layout.\n"
+          "  -i          Write an index of (line offset, unix time) pairs\n"
+          "  -j threads  Number of worker threads, default all cores\n",
+          name, (unsigned long long)EXTRACT_NO_TIME);
+}
+
+/**
+ * @brief Reads the thread count of the -j option.
+ *
+ * @param arg The option argument
+ * @param threadCount Reference to store the count
+ * @return int 1 for a positive decimal number without trailing characters, 0
+ * otherwise
+ */
+static int extract_parseThreads(const char *arg, long *threadCount) {
+  char *end = NULL;
+  errno = 0;
+  const long value = strtol(arg, &end, 10);
+  if (end == arg || '\0' != *end || 0 != errno || value < 1) {
+    return 0;
+  }
+  *threadCount = value;
+  return 1;
+}
+
+int main(int argc, char **argv) {
+  EXTRACT_MODES mode = EXTRACT_COLUMN;
+  long threadCount = sysconf(_SC_NPROCESSORS_ONLN);
+  int option;
+  while (-1 != (option = getopt(argc, argv, "ij:h"))) {
+    switch (option) {
+    case 'i':
+      mode = EXTRACT_INDEX;
+      break;
+    case 'j':
+      if (!extract_parseThreads(optarg, &threadCount)) {
+        fprintf(stderr, "Invalid thread count: %s\n", optarg);
+        extract_usage(argv[0]);
+        return EXIT_FAILURE;
+      }
+      break;
+    default:
+      extract_usage(argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+  if (2 != argc - optind) {
+    extract_usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+  if (threadCount < 1) {
+    threadCount = 1;
+  } else if (threadCount > (long)EXTRACT_MAX_THREADS) {
+    threadCount = EXTRACT_MAX_THREADS;
+  }
+
+  int inFd = open(argv[optind], O_RDONLY);
+  if (inFd < 0) {
+    perror(argv[optind]);
+    return EXIT_FAILURE;
+  }
+  struct stat inStat;
+  if (0 != fstat(inFd, &inStat)) {
+    perror(argv[optind]);
+    close(inFd);
+    return EXIT_FAILURE;
+  }
+  const size_t size = (size_t)inStat.st_size;
+  const char *data = NULL;
+  if (size > 0) {
+    data = mmap(NULL, size, PROT_READ, MAP_PRIVATE, inFd, 0);
+    if (MAP_FAILED == data) {
+      perror("mmap");
+      close(inFd);
+      return EXIT_FAILURE;
+    }
+    // Each thread reads its range once from front to back
+    madvise((void *)data, size, MADV_SEQUENTIAL);
+  }
+  close(inFd);
+
+  int outFd = open(argv[optind + 1], O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (outFd < 0) {
+    perror(argv[optind + 1]);
+    if (NULL != data) {
+      munmap((void *)data, size);
+    }
+    return EXIT_FAILURE;
+  }
+
+  // Count the lines of each range first, so every thread knows the output
+  // position of its records and writes them without any merge step
+  static extractRangeType ranges[EXTRACT_MAX_THREADS];
+  const size_t rangeCount = extract_splitRanges(ranges, (size_t)threadCount, data, size);
+  int result = extract_runThreads(ranges, rangeCount, extract_countRange);
+  uint64_t lines = 0;
+  for (size_t i = 0; i < rangeCount; i++) {
+    ranges[i].firstLine = lines;
+    ranges[i].mode = mode;
+    ranges[i].outFd = outFd;
+    lines += ranges[i].lines;
+  }
+  const size_t recordSize = EXTRACT_INDEX == mode ? sizeof(tinyExtractIndexType) : sizeof(tinyUnixType);
+  if (0 == result && 0 != ftruncate(outFd, (off_t)(lines * recordSize))) {
+    perror(argv[optind + 1]);
+    result = -1;
+  }
+  if (0 == result) {
+    result = extract_runThreads(ranges, rangeCount, extract_runRange);
+  }
+  if (0 != result) {
+    fprintf(stderr, "Failed to start the worker threads\n");
+  }
+
+  uint64_t timestamps = 0;
+  for (size_t i = 0; i < rangeCount && 0 == result; i++) {
+    if (0 != ranges[i].error) {
+      fprintf(stderr, "%s: %s\n", argv[optind + 1], strerror(ranges[i].error));
+      result = -1;
+    }
+    timestamps += ranges[i].timestamps;
+  }
+  if (0 != close(outFd) && 0 == result) {
+    perror(argv[optind + 1]);
+    result = -1;
+  }
+  if (NULL != data) {
+    munmap((void *)data, size);
+  }
+  if (0 != result) {
+    return EXIT_FAILURE;
+  }
+  fprintf(stderr, "%llu lines, %llu timestamps, %zu threads\n", (unsigned long long)lines,
+          (unsigned long long)timestamps, rangeCount);
+  return EXIT_SUCCESS;
+}